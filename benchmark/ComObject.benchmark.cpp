@@ -0,0 +1,234 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/ClassFactory.h"
+#include "m3c/ComObject.h"
+#include "m3c/com_ptr.h"
+
+#include <benchmark/benchmark.h>
+
+#include <windows.h>
+#include <unknwn.h>
+
+#include <utility>
+
+namespace m3c::benchmarks {
+
+namespace {
+
+MIDL_INTERFACE("8A548B28-AE85-4803-902E-89100564BA0D")
+IBench0 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("F3C30A9D-7C7D-4181-931A-3D35438BD2CA")
+IBench1 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("ED4C374F-0FAC-4437-A866-B17A77B16A97")
+IBench2 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("ABEFCBD9-C535-4240-8201-D03A25C5A516")
+IBench3 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("01CFD5F6-46A2-4A61-BD56-62973BE7316C")
+IBench4 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("077CEFBD-1ECA-4805-A919-4C496F7BFB6D")
+IBench5 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("DC86CDAB-CC28-41B3-A8C6-8DEEB7A018AF")
+IBench6 : public IUnknown{
+              // no additional methods
+          };
+
+MIDL_INTERFACE("CC1F217F-48F4-4419-8C9E-8E82AC106715")
+IBench7 : public IUnknown{
+              // no additional methods
+          };
+
+/// @brief An interface which is not implemented by any of the objects.
+MIDL_INTERFACE("B52B4CEB-3FDF-4094-96A4-C7F2D46E240A")
+IBenchMissing : public IUnknown{
+                    // no additional methods
+                };
+
+class Object1 final : public ComObject<IBench0> {
+	// default
+};
+
+class Object4 final : public ComObject<IBench0, IBench1, IBench2, IBench3> {
+	// default
+};
+
+class Object8 final : public ComObject<IBench0, IBench1, IBench2, IBench3, IBench4, IBench5, IBench6, IBench7> {
+	// default
+};
+
+/// @brief The object shared by all threads of the contended benchmarks.
+com_ptr<IBench0> s_shared;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared between benchmark threads.
+
+/// @brief Create the object shared by all threads.
+void SetupShared(const benchmark::State& /* state */) {
+	s_shared = make_com<IBench0, Object1>();
+}
+
+/// @brief Release the object shared by all threads.
+void TeardownShared(const benchmark::State& /* state */) {
+	s_shared.reset();
+}
+
+}  // namespace
+
+
+//
+// Creation
+//
+
+template <typename T>
+void ComObject_Create(benchmark::State& state) {
+	for (auto _ : state) {
+		com_ptr<IBench0> ptr = make_com<IBench0, T>();
+		benchmark::DoNotOptimize(ptr.get());
+	}
+}
+BENCHMARK_TEMPLATE(ComObject_Create, Object1);
+BENCHMARK_TEMPLATE(ComObject_Create, Object4);
+BENCHMARK_TEMPLATE(ComObject_Create, Object8);
+
+void ClassFactory_CreateInstance(benchmark::State& state) {
+	const com_ptr<IClassFactory> factory = make_com<IClassFactory, ClassFactory<Object1>>();
+	for (auto _ : state) {
+		com_ptr<IBench0> ptr;
+		const HRESULT hr = factory->CreateInstance(nullptr, __uuidof(IBench0), reinterpret_cast<void**>(&ptr));
+		benchmark::DoNotOptimize(hr);
+	}
+}
+BENCHMARK(ClassFactory_CreateInstance);
+
+/// @brief Creation and destruction of objects in parallel, all threads update the global object count in `COM`.
+void ComObject_Create_Threads(benchmark::State& state) {
+	for (auto _ : state) {
+		com_ptr<IBench0> ptr = make_com<IBench0, Object1>();
+		benchmark::DoNotOptimize(ptr.get());
+	}
+}
+BENCHMARK(ComObject_Create_Threads)->ThreadRange(1, 8)->UseRealTime();
+
+
+//
+// QueryInterface
+//
+
+/// @brief `QueryInterface` for the interface which is checked last.
+template <typename T, typename I>
+void ComObject_QueryInterface_Hit(benchmark::State& state) {
+	const com_ptr<IBench0> object = make_com<IBench0, T>();
+	IUnknown* const pUnknown = object.get();
+	for (auto _ : state) {
+		void* pObject;  // NOLINT(cppcoreguidelines-init-variables): Set by QueryInterface.
+		const HRESULT hr = pUnknown->QueryInterface(__uuidof(I), &pObject);
+		benchmark::DoNotOptimize(hr);
+		static_cast<IUnknown*>(pObject)->Release();
+	}
+}
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Hit, Object1, IBench0);
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Hit, Object4, IBench3);
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Hit, Object8, IBench7);
+
+/// @brief `QueryInterface` for an interface which is not implemented.
+template <typename T>
+void ComObject_QueryInterface_Miss(benchmark::State& state) {
+	const com_ptr<IBench0> object = make_com<IBench0, T>();
+	IUnknown* const pUnknown = object.get();
+	for (auto _ : state) {
+		void* pObject;  // NOLINT(cppcoreguidelines-init-variables): Set by QueryInterface.
+		const HRESULT hr = pUnknown->QueryInterface(__uuidof(IBenchMissing), &pObject);
+		benchmark::DoNotOptimize(hr);
+	}
+}
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Miss, Object1);
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Miss, Object4);
+BENCHMARK_TEMPLATE(ComObject_QueryInterface_Miss, Object8);
+
+
+//
+// AddRef and Release
+//
+
+void ComObject_AddRefRelease(benchmark::State& state) {
+	const com_ptr<IBench0> object = make_com<IBench0, Object1>();
+	IUnknown* const pUnknown = object.get();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(pUnknown->AddRef());
+		benchmark::DoNotOptimize(pUnknown->Release());
+	}
+}
+BENCHMARK(ComObject_AddRefRelease);
+
+/// @brief `AddRef` and `Release` of a single object from multiple threads.
+void ComObject_AddRefRelease_Threads(benchmark::State& state) {
+	IUnknown* const pUnknown = s_shared.get();
+	for (auto _ : state) {
+		benchmark::DoNotOptimize(pUnknown->AddRef());
+		benchmark::DoNotOptimize(pUnknown->Release());
+	}
+}
+BENCHMARK(ComObject_AddRefRelease_Threads)->Setup(SetupShared)->Teardown(TeardownShared)->ThreadRange(1, 8)->UseRealTime();
+
+
+//
+// com_ptr
+//
+
+void com_ptr_Copy(benchmark::State& state) {
+	const com_ptr<IBench0> object = make_com<IBench0, Object1>();
+	for (auto _ : state) {
+		com_ptr<IBench0> copy(object);
+		benchmark::DoNotOptimize(copy.get());
+	}
+}
+BENCHMARK(com_ptr_Copy);
+
+void com_ptr_Move(benchmark::State& state) {
+	com_ptr<IBench0> object = make_com<IBench0, Object1>();
+	for (auto _ : state) {
+		com_ptr<IBench0> moved(std::move(object));
+		benchmark::DoNotOptimize(moved.get());
+		object = std::move(moved);
+	}
+}
+BENCHMARK(com_ptr_Move);
+
+/// @brief Copies of a single object from multiple threads.
+void com_ptr_Copy_Threads(benchmark::State& state) {
+	for (auto _ : state) {
+		com_ptr<IBench0> copy(s_shared);
+		benchmark::DoNotOptimize(copy.get());
+	}
+}
+BENCHMARK(com_ptr_Copy_Threads)->Setup(SetupShared)->Teardown(TeardownShared)->ThreadRange(1, 8)->UseRealTime();
+
+}  // namespace m3c::benchmarks
@@ -94,9 +94,11 @@ function(common_cpp_target_events target events #[[ [ DESTINATION <path> ] [ LEV
         DEPENDS "${src_dir}/${file}" "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/merge-events.vbs" ${includes}
         COMMAND_EXPAND_LISTS)
 
+    # read the source manifests directly, the tables do not require any Windows SDK tools
+    list(JOIN includes "|" map_files)
     add_custom_command(OUTPUT "${cpp_file}"
-        COMMAND "${CMAKE_COMMAND}" "-DMODE=MAP" "-DFILE=${man_file}" "-DOUT=${cpp_file}" -P "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/process-events.cmake"
-        DEPENDS "${man_file}" "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/process-events.cmake")
+        COMMAND "${CMAKE_COMMAND}" "-DMODE=MAP" "-DFILE=${src_dir}/${file}|${map_files}" "-DOUT=${cpp_file}" -P "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/process-events.cmake"
+        DEPENDS "${src_dir}/${file}" "${CMAKE_CURRENT_FUNCTION_LIST_DIR}/process-events.cmake" ${includes})
 
     add_custom_command(OUTPUT "${rc_file}" "${htmp_file}"
         COMMAND mc -e th -h "${bin_dir}" -n -r "${bin_dir}" "${man_file}" 
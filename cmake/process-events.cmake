@@ -14,7 +14,15 @@
 
 cmake_minimum_required(VERSION 3.20 FATAL_ERROR)
 
-file(READ "${FILE}" content)
+# FILE MAY contain multiple files separated by | which are read as one
+string(REPLACE "|" ";" files "${FILE}")
+set(content "")
+foreach(file IN LISTS files)
+    if(file)
+        file(READ "${file}" part)
+        string(APPEND content "${part}")
+    endif()
+endforeach()
 
 if("${MODE}" STREQUAL "HEADER")
     string(REPLACE [[#pragma once]] [[
@@ -24,7 +32,8 @@ if("${MODE}" STREQUAL "HEADER")
 #include <evntprov.h>
 #include <guiddef.h>
 
-#include <map>
+#include <span>
+#include <utility>
 
 namespace m3c {
 ]] content "${content}")
@@ -52,16 +61,17 @@ namespace m3c {
     string(APPEND content [[
 
 namespace m3c::internal {
-extern const std::map<USHORT, DWORD> kEventMessages;
-extern const std::map<UCHAR, DWORD> kLevelNames;
+extern const std::span<const std::pair<USHORT, DWORD>> kEventMessages;
+extern const std::span<const std::pair<UCHAR, DWORD>> kLevelNames;
 }  // namespace m3c::internal
 ]])
 elseif("${MODE}" STREQUAL "MAP")
-    function(create_message_map element map type var)
-        string(CONFIGURE [[<[ \r\n\t]*@element@[ \r\n\t]+[^>]*>]] pattern @ONLY)
+    function(create_message_map element table map type var)
+        string(CONFIGURE "<[ \r\n\t]*@element@[ \r\n\t]+[^>]*>" pattern @ONLY)
         string(REGEX MATCHALL "${pattern}" matches "${content}" )
 
         unset(result)
+        unset(ids)
         foreach(match IN LISTS matches)
             string(CONFIGURE "^<[ \r\n\t]*@element@([ \r\n\t]+[a-z0-9_-]+=\"[^\">]*\")*[ \r\n\t]+value=\"([^\">]*)\"([ \r\n\t]+[a-z0-9_-]+=\"[^\">]*\")*[ \r\n\t]*/?[ \r\n\t]*>\$" pattern @ONLY)
             string(REGEX MATCH "${pattern}" id "${match}" )
@@ -78,16 +88,33 @@ elseif("${MODE}" STREQUAL "MAP")
 
             string(MAKE_C_IDENTIFIER "${message}" message)
 
-            list(APPEND result "    { ${id}, MSG_${message} }")
+            list(APPEND ids "${id}")
+            list(APPEND result "    {${id}, MSG_${message}}")
         endforeach()
+
+        set(unique "${ids}")
+        list(REMOVE_DUPLICATES unique)
+        if(NOT ids STREQUAL unique)
+            message(FATAL_ERROR "Duplicate ${element} value in ${FILE}")
+        endif()
+
+        # sort by value for binary search
+        list(SORT result COMPARE NATURAL)
+        list(LENGTH result size)
         list(JOIN result ",\n" result)
-        string(PREPEND result "const std::map<${type}, DWORD> ${map} = {\n")
-        string(APPEND result "\n};\n")
+        string(CONFIGURE [[
+constexpr std::array<std::pair<@type@, DWORD>, @size@> @table@ = {{
+@result@
+}};
+static_assert(std::ranges::is_sorted(@table@, {}, &std::pair<@type@, DWORD>::first));
+
+const std::span<const std::pair<@type@, DWORD>> @map@ = @table@;
+]] result @ONLY)
         set("${var}" "${result}" PARENT_SCOPE)
     endfunction()
 
-    create_message_map(event kEventMessages USHORT eventMap)
-    create_message_map(level kLevelNames UCHAR levelMap)
+    create_message_map(event kEventMessageTable kEventMessages USHORT eventMap)
+    create_message_map(level kLevelNameTable kLevelNames UCHAR levelMap)
 
     cmake_path(REPLACE_EXTENSION OUT LAST_ONLY "h" OUTPUT_VARIABLE include)
     cmake_path(GET OUT PARENT_PATH path)
@@ -98,14 +125,15 @@ elseif("${MODE}" STREQUAL "MAP")
 
 #include <windows.h>
 
-#include <map>
+#include <algorithm>
+#include <array>
+#include <span>
+#include <utility>
 
 namespace m3c::internal {
 
 @eventMap@
-
 @levelMap@
-
 }  // namespace m3c::internal
 ]] content @ONLY)
 else()
@@ -226,28 +226,10 @@ public:
 
 private:
 	[[nodiscard]] constexpr _Ret_maybenull_ void* FindInterfaceInternal(REFIID riid) noexcept final {
-		return FindInterfaceInArgs<Interfaces...>(riid);
-	}
-
-	/// @brief A helper method for unpacking the template arguments.
-	/// @tparam First The first interface.
-	/// @tparam Remaining The remaining interfaces.
-	/// @param riid The requested interface.
-	/// @return A pointer to the interface or `nullptr` if the interface is not supported.
-	template <typename First, typename... Remaining>
-	[[nodiscard]] constexpr _Ret_maybenull_ void* FindInterfaceInArgs(REFIID riid) noexcept {
-		if (IsEqualIID(riid, __uuidof(First))) {
-			return static_cast<First*>(this);
-		}
-		return FindInterfaceInArgs<Remaining...>(riid);
-	}
-
-	/// @brief A helper method for the last iteration when unpacking the template arguments, internally calls `FindInterface`.
-	/// @param riid The requested interface.
-	/// @return A pointer to the interface or `nullptr` if the interface is not supported.
-	template <int = 0>
-	[[nodiscard]] constexpr _Ret_maybenull_ void* FindInterfaceInArgs(REFIID riid) noexcept {
-		return FindInterface(riid);
+		void* pInterface = nullptr;
+		// fold expression stops at the first match
+		static_cast<void>(((IsEqualIID(riid, __uuidof(Interfaces)) ? (pInterface = static_cast<Interfaces*>(this), true) : false) || ...));
+		return pInterface ? pInterface : FindInterface(riid);
 	}
 };
 
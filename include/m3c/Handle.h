@@ -19,11 +19,14 @@ limitations under the License.
 
 #include "m3c/LogArgs.h"
 #include "m3c/LogData.h"
+#include "m3c/leak_tracker.h"
+#include "m3c/source_location.h"
 
 #include <fmt/format.h>
 
 #include <windows.h>
 
+#include <concepts>
 #include <cstddef>
 #include <functional>
 #include <utility>
@@ -32,6 +35,17 @@ namespace m3c {
 
 namespace internal {
 
+/// @brief A strategy to close handles of a particular type for use with `BaseHandle`.
+/// @details A strategy provides a static function `Close` which reports errors by throwing an exception and a static
+/// function `CloseSilently` which logs errors. Both functions are only called for valid handles.
+/// @tparam T The type of the strategy.
+template <typename T>
+concept CloseStrategy = requires(HANDLE hNative) {
+	{ T::Close(hNative) } -> std::same_as<void>;
+	{ T::CloseSilently(hNative) } -> std::same_as<void>;
+	requires noexcept(T::CloseSilently(hNative));
+};
+
 /// @brief Strategy to close regular handles.
 struct HandleCloser final {
 	HandleCloser() = delete;
@@ -60,19 +74,42 @@ struct FindCloser final {
 };
 
 
+/// @brief Strategy to close regular handles in a background thread.
+/// @details `CloseSilently`, i.e. the path used by the destructor and assignment, queues the handle for a background
+/// thread which closes handles in batches. Errors are logged from the background thread. If the queue is full or the
+/// background thread is not available, the handle is closed synchronously. `Close` always closes synchronously because
+/// the caller expects an exception in case of errors.
+struct AsyncHandleCloser final {
+	AsyncHandleCloser() = delete;
+
+	/// @brief Close the handle throwing an exception in case of errors.
+	/// @param hNative The handle to close.
+	static void Close(HANDLE hNative);
+
+	/// @brief Queues the handle for closing in the background thread, errors are logged.
+	/// @param hNative The handle to close.
+	static void CloseSilently(HANDLE hNative) noexcept;
+};
+
+
 /// @brief A RAII type for windows `HANDLE` values.
-/// @tparam Closer The type of the strategy to close the handle.
+/// @tparam Closer The type of the strategy to close the handle, MUST satisfy `CloseStrategy`.
 template <typename Closer>
 class BaseHandle final {
+	static_assert(CloseStrategy<Closer>, "Closer must provide Close and noexcept CloseSilently");
+
 public:
 	/// @brief Creates an empty instance.
 	[[nodiscard]] constexpr BaseHandle() noexcept = default;
 
 	/// @brief Transfer ownership of an existing handle.
 	/// @param hNative The native `HANDLE`.
-	[[nodiscard]] constexpr BaseHandle(HANDLE hNative) noexcept  // NOLINT(google-explicit-constructor): Type should act as a drop-in replacement.
+	/// @param location The location where ownership is acquired, used by `leak_tracker`.
+	[[nodiscard]] constexpr BaseHandle(HANDLE hNative, const std::source_location& location = std::source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Type should act as a drop-in replacement.
 	    : m_hNative(hNative) {
-		// empty
+		if (m_hNative != kInvalid) {
+			leak_tracker::track(m_hNative, location);
+		}
 	}
 
 	BaseHandle(const BaseHandle&) = delete;
@@ -80,13 +117,14 @@ public:
 	/// @brief Transfers ownership.
 	/// @param handle Another `BaseHandle`.
 	[[nodiscard]] constexpr BaseHandle(BaseHandle&& handle) noexcept
-	    : m_hNative(handle.release()) {
+	    : m_hNative(std::exchange(handle.m_hNative, kInvalid)) {
 		// empty
 	}
 
 	/// @brief Calls `CloseHandle`.
 	~BaseHandle() noexcept {
 		if (m_hNative != kInvalid) {
+			leak_tracker::untrack(m_hNative);
 			Closer::CloseSilently(m_hNative);
 		}
 	}
@@ -99,9 +137,11 @@ public:
 	/// @return This instance.
 	constexpr BaseHandle& operator=(BaseHandle&& handle) noexcept {
 		if (m_hNative != kInvalid) {
+			leak_tracker::untrack(m_hNative);
 			Closer::CloseSilently(m_hNative);
 		}
-		m_hNative = handle.release();
+		// the handle remains tracked with its original location
+		m_hNative = std::exchange(handle.m_hNative, kInvalid);
 		return *this;
 	}
 
@@ -110,9 +150,14 @@ public:
 	/// @return This instance.
 	constexpr BaseHandle& operator=(HANDLE hNative) noexcept {
 		if (m_hNative != kInvalid) {
+			leak_tracker::untrack(m_hNative);
 			Closer::CloseSilently(m_hNative);
 		}
 		m_hNative = hNative;
+		if (m_hNative != kInvalid) {
+			// operators cannot capture the location of the caller
+			leak_tracker::track(m_hNative, std::source_location());
+		}
 		return *this;
 	}
 
@@ -161,6 +206,7 @@ public:
 	/// @brief Close the handle.
 	constexpr void close() {
 		if (m_hNative != kInvalid) {
+			leak_tracker::untrack(m_hNative);
 			Closer::Close(m_hNative);
 			m_hNative = kInvalid;
 		}
@@ -172,6 +218,9 @@ public:
 	[[nodiscard]] constexpr HANDLE release() noexcept {
 		HANDLE hNative = m_hNative;
 		m_hNative = kInvalid;
+		if (hNative != kInvalid) {
+			leak_tracker::untrack(hNative);
+		}
 		return hNative;
 	}
 
@@ -197,6 +246,7 @@ private:
 
 extern template class BaseHandle<HandleCloser>;
 extern template class BaseHandle<FindCloser>;
+extern template class BaseHandle<AsyncHandleCloser>;
 
 //
 // operator==
@@ -240,6 +290,10 @@ extern template bool operator==(const BaseHandle<FindCloser>& handle, const Base
 extern template bool operator==(const BaseHandle<FindCloser>& handle, const HANDLE hNative) noexcept;
 extern template bool operator==(const HANDLE hNative, const BaseHandle<FindCloser>& handle) noexcept;
 
+extern template bool operator==(const BaseHandle<AsyncHandleCloser>& handle, const BaseHandle<AsyncHandleCloser>& oth) noexcept;
+extern template bool operator==(const BaseHandle<AsyncHandleCloser>& handle, const HANDLE hNative) noexcept;
+extern template bool operator==(const HANDLE hNative, const BaseHandle<AsyncHandleCloser>& handle) noexcept;
+
 
 //
 // operator!=
@@ -283,6 +337,10 @@ extern template bool operator!=(const BaseHandle<FindCloser>& handle, const Base
 extern template bool operator!=(const BaseHandle<FindCloser>& handle, const HANDLE hNative) noexcept;
 extern template bool operator!=(const HANDLE hNative, const BaseHandle<FindCloser>& handle) noexcept;
 
+extern template bool operator!=(const BaseHandle<AsyncHandleCloser>& handle, const BaseHandle<AsyncHandleCloser>& oth) noexcept;
+extern template bool operator!=(const BaseHandle<AsyncHandleCloser>& handle, const HANDLE hNative) noexcept;
+extern template bool operator!=(const HANDLE hNative, const BaseHandle<AsyncHandleCloser>& handle) noexcept;
+
 
 /// @brief Swap function.
 /// @tparam Closer The type of the strategy to close the handle.
@@ -295,6 +353,7 @@ constexpr void swap(BaseHandle<Closer>& handle, BaseHandle<Closer>& oth) noexcep
 
 extern template void swap(BaseHandle<HandleCloser>& handle, BaseHandle<HandleCloser>& oth) noexcept;
 extern template void swap(BaseHandle<FindCloser>& handle, BaseHandle<FindCloser>& oth) noexcept;
+extern template void swap(BaseHandle<AsyncHandleCloser>& handle, BaseHandle<AsyncHandleCloser>& oth) noexcept;
 
 }  // namespace internal
 
@@ -305,12 +364,23 @@ using Handle = internal::BaseHandle<internal::HandleCloser>;
 /// @brief A RAII type for windows `HANDLE` values used in the calls `FindFirstFile` etc.
 using FindHandle = internal::BaseHandle<internal::FindCloser>;
 
+/// @brief A RAII type for windows `HANDLE` values which are closed in a background thread.
+/// @details Use for handles where closing might block, e.g. file handles on network drives.
+using AsyncHandle = internal::BaseHandle<internal::AsyncHandleCloser>;
+
 // assert no size overhead
 static_assert(sizeof(Handle) == sizeof(HANDLE));
 
 // assert no size overhead
 static_assert(sizeof(FindHandle) == sizeof(HANDLE));
 
+// assert no size overhead
+static_assert(sizeof(AsyncHandle) == sizeof(HANDLE));
+
+/// @brief Wait until the background thread has closed all queued handles of `AsyncHandle` objects.
+/// @details Call this function during shutdown. Handles which are queued while waiting are also waited for.
+void flush_async_handles() noexcept;
+
 }  // namespace m3c
 
 
@@ -325,6 +395,7 @@ struct std::hash<m3c::internal::BaseHandle<Closer>> {
 
 extern template struct std::hash<m3c::internal::BaseHandle<m3c::internal::HandleCloser>>;
 extern template struct std::hash<m3c::internal::BaseHandle<m3c::internal::FindCloser>>;
+extern template struct std::hash<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>>;
 
 
 /// @brief Specialization of `fmt::formatter` for a `BaseHandle`.
@@ -347,3 +418,5 @@ extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::H
 extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::HandleCloser>, wchar_t>;
 extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::FindCloser>, char>;
 extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::FindCloser>, wchar_t>;
+extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>, char>;
+extern template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>, wchar_t>;
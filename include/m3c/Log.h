@@ -18,7 +18,9 @@ limitations under the License.
 #pragma once
 
 #include <m3c/LogArgs.h>
+#include <m3c/LogData.h>
 #include <m3c/format.h>  // IWYU pragma: export
+#include <m3c/lazy.h>
 #include <m3c/source_location.h>
 #include <m3c/type_traits.h>
 
@@ -26,7 +28,11 @@ limitations under the License.
 #include <evntprov.h>
 #include <winmeta.h>
 
+#include <atomic>
+#include <cstdint>
+#include <exception>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -57,12 +63,6 @@ void Print(Priority priority, const std::string& message);
 
 namespace internal {
 
-/// @brief A type of log message.
-/// @tparam T The actual type of the log message.
-template <typename T>
-concept LogMessage = AnyOf<T, const EVENT_DESCRIPTOR&, const char*>;
-
-
 /// @brief Log context with message and source location.
 /// @remarks Used to automatically supply the source location to log functions with variable number of arguments.
 /// @tparam M The type of the log message.
@@ -77,7 +77,7 @@ public:
 	/// @details The string is not copied, therefore this function MUST only be used as an immediate argument to a logging call.
 	/// @param message The log message.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr LogContext(const M message, const std::source_location sourceLocation = std::source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
+	[[nodiscard]] constexpr LogContext(const M message, const source_location sourceLocation = source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
 	    : m_sourceLocation(sourceLocation)
 	    , m_message(message) {
 	}
@@ -86,7 +86,7 @@ public:
 	/// @details The string is not copied, therefore this function MUST only be used as an immediate argument to a logging call.
 	/// @param message The log message.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr LogContext(const std::string& message, const std::source_location sourceLocation = std::source_location::current()) noexcept requires(!kIsEventDescriptor)  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
+	[[nodiscard]] constexpr LogContext(const std::string& message, const source_location sourceLocation = source_location::current()) noexcept requires(!kIsEventDescriptor)  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
 	    : m_sourceLocation(sourceLocation)
 	    , m_message(message.c_str()) {
 	}
@@ -95,7 +95,7 @@ public:
 	/// @details The string is not copied, therefore this function MUST only be used as an immediate argument to a logging call.
 	/// @param message The log message.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr LogContext(std::string&& message, const std::source_location sourceLocation = std::source_location::current()) noexcept requires(!kIsEventDescriptor)  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
+	[[nodiscard]] constexpr LogContext(std::string&& message, const source_location sourceLocation = source_location::current()) noexcept requires(!kIsEventDescriptor)  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
 	    : m_sourceLocation(sourceLocation)
 	    , m_message(message.c_str()) {
 	}
@@ -112,7 +112,7 @@ public:
 public:
 	/// @brief Get the source location.
 	/// @return The source location.
-	[[nodiscard]] constexpr const std::source_location& GetSourceLocation() const noexcept {
+	[[nodiscard]] constexpr const source_location& GetSourceLocation() const noexcept {
 		return m_sourceLocation;
 	}
 
@@ -124,7 +124,7 @@ public:
 	}
 
 private:
-	const std::source_location m_sourceLocation;  ///< @brief The source location.
+	const source_location m_sourceLocation;  ///< @brief The source location.
 	const M m_message;                            ///< @brief The log messsage.
 };
 
@@ -187,6 +187,7 @@ using ClosureNoexcept = Closure<true, R, Args...>;
 extern template class Closure<false, void, LogFormatArgs&>;
 extern template class Closure<false, void, LogEventArgs&>;
 extern template class Closure<true, void, Priority, HRESULT>;
+extern template class Closure<false, void, LogData&>;
 
 
 /// @brief Get the string message for the event id.
@@ -195,6 +196,8 @@ extern template class Closure<true, void, Priority, HRESULT>;
 /// @return The message string.
 [[nodiscard]] std::string GetEventMessagePattern(USHORT eventId);
 
+class PendingEvents;
+
 }  // namespace internal
 
 
@@ -238,8 +241,10 @@ public:
 #define MAIN_METHOD(type_, message_, exception_)                                                                                      \
 	template <typename... Args>                                                                                                       \
 	static void message_##exception_(const Priority priority, const internal::LogContext<type_>&& context, Args&&... args) noexcept { \
-		if (priority <= kLevel) {                                                                                                     \
+		if (priority <= kLevel && IsSampled(priority)) {                                                                              \
 			GetInstance().Log##message_##exception_(priority, context, args...);                                                      \
+		} else {                                                                                                                      \
+			Filtered##message_##exception_(priority, context, args...);                                                               \
 		}                                                                                                                             \
 	}
 
@@ -251,8 +256,10 @@ public:
 #define LEVEL_METHOD(priority_, type_, message_, exception_)                                                  \
 	template <typename... Args>                                                                               \
 	static void priority_##exception_(const internal::LogContext<type_>&& context, Args&&... args) noexcept { \
-		if (Priority::k##priority_ <= kLevel) {                                                               \
+		if (Priority::k##priority_ <= kLevel && IsSampled(Priority::k##priority_)) {                          \
 			GetInstance().Log##message_##exception_(Priority::k##priority_, context, args...);                \
+		} else {                                                                                              \
+			Filtered##message_##exception_(Priority::k##priority_, context, args...);                         \
 		}                                                                                                     \
 	}
 
@@ -265,7 +272,7 @@ public:
 	template <typename... Args>                                                                                     \
 	static void priority_##exception_##Once(const internal::LogContext<type_>&& context, Args&&... args) noexcept { \
 		static_assert(internal::LogContext<type_>::kIsEventDescriptor, "not an event descriptor");                  \
-		if (Priority::k##priority_ <= kLevel) {                                                                     \
+		if (Priority::k##priority_ <= kLevel && IsSampled(Priority::k##priority_)) {                                \
 			USHORT* const pEventId = LogOnce(context.GetLogMessage().Id);                                           \
 			if (pEventId) {                                                                                         \
 				[[likely]];                                                                                         \
@@ -280,23 +287,29 @@ public:
 #define RESULT_METHOD(type_)                                                                                                                                     \
 	template <typename R, typename... Args>                                                                                                                      \
 	[[nodiscard]] static _Ret_range_(==, rv) R TraceResult(R&& rv, const internal::LogContext<type_>&& context, Args&&... args) noexcept {                       \
-		if (Priority::kTrace <= kLevel) {                                                                                                                        \
+		if (Priority::kTrace <= kLevel && IsSampled(Priority::kTrace)) {                                                                                         \
 			GetInstance().LogMessage(Priority::kTrace, context, rv, args...);                                                                                    \
+		} else {                                                                                                                                                 \
+			FilteredMessage(Priority::kTrace, context, rv, args...);                                                                                             \
 		}                                                                                                                                                        \
 		return std::forward<R>(rv);                                                                                                                              \
 	}                                                                                                                                                            \
 	template <typename... Args>                                                                                                                                  \
 	[[nodiscard]] static _Ret_range_(==, rv) HRESULT TraceHResult(const HRESULT rv, const internal::LogContext<type_>&& context, Args&&... args) noexcept {      \
-		if (Priority::kTrace <= kLevel) {                                                                                                                        \
+		if (Priority::kTrace <= kLevel && IsSampled(Priority::kTrace)) {                                                                                         \
 			GetInstance().LogMessage(Priority::kTrace, context, static_cast<DWORD>(rv), args...);                                                                \
+		} else {                                                                                                                                                 \
+			FilteredMessage(Priority::kTrace, context, static_cast<DWORD>(rv), args...);                                                                         \
 		}                                                                                                                                                        \
 		return rv;                                                                                                                                               \
 	}                                                                                                                                                            \
 	template <typename... Args>                                                                                                                                  \
 	[[nodiscard]] static _Ret_range_(<, 0) HRESULT ExceptionToHResult(const Priority priority, internal::LogContext<type_>&& context, Args&&... args) noexcept { \
 		return ExceptionToHResult(priority, [&context, &args...](const Priority priority, const HRESULT hr) noexcept {                                           \
-			if (priority <= kLevel) {                                                                                                                            \
+			if (priority <= kLevel && IsSampled(priority)) {                                                                                                     \
 				GetInstance().LogException(priority, context, args..., hresult(hr));                                                                             \
+			} else {                                                                                                                                             \
+				FilteredException(priority, context, args..., hresult(hr));                                                                                      \
 			}                                                                                                                                                    \
 		});                                                                                                                                                      \
 	}
@@ -373,14 +386,77 @@ public:
 	/// @param message The formatted log message.
 	static void PrintDefault(Priority priority, const std::string& message);
 
+	/// @brief Wait until the logger has registered with the Windows event log.
+	/// @details Registration runs in a thread pool thread. Events logged in the meantime are queued and written once the
+	/// registration has completed. Call this function if events MUST be written in order with other output, e.g. in tests.
+	static void WaitForRegistration() noexcept;
+
+	/// @brief Log messages with priority `Priority::kVerbose` and below for only one in @p rate activities.
+	/// @details The decision is derived from a hash of the activity id of the current thread, so all messages of an
+	/// activity are either logged or dropped together. Messages outside of an activity are always logged.
+	/// @param rate The sampling rate, `1` to log all activities. The value is rounded up to the next power of two and
+	/// limited to 2^30.
+	static void SetSampleRate(std::uint32_t rate) noexcept;
+
+	/// @brief Log messages up to @p priority at all call sites in files matching @p pattern.
+	/// @details Messages enabled for a call site are logged regardless of the log level and the sampling rate. Rules
+	/// apply immediately, both to call sites which have already been hit and to new ones.
+	/// @param pattern The file name relative to `M3C_SOURCE_ROOT`. The pattern MAY contain the wildcards `*` and `?`
+	/// and is matched case-insensitive. `/` and `\` are treated as the same character.
+	/// @param priority The least important priority which is logged.
+	static void EnableFile(std::string_view pattern, Priority priority = Priority::kTrace);
+
+	/// @brief Log messages up to @p priority at all call sites in functions matching @p pattern.
+	/// @param pattern The function name as returned by `source_location::function_name()`. The pattern MAY contain
+	/// the wildcards `*` and `?`.
+	/// @param priority The least important priority which is logged.
+	static void EnableFunction(std::string_view pattern, Priority priority = Priority::kTrace);
+
+	/// @brief Log messages up to @p priority at all call sites in a range of lines in files matching @p pattern.
+	/// @param pattern The file name, same as for `EnableFile`.
+	/// @param first The first line.
+	/// @param last The last line (inclusive).
+	/// @param priority The least important priority which is logged.
+	static void EnableLines(std::string_view pattern, std::uint_least32_t first, std::uint_least32_t last, Priority priority = Priority::kTrace);
+
+	/// @brief Remove all rules added using `EnableFile`, `EnableFunction` and `EnableLines`.
+	static void DisableSites() noexcept;
+
 private:
 	/// @brief Get the single logger instance.
+	/// @details The instance is created on first use. Afterwards, access requires a single acquire load only.
 	/// @return The single logger instance.
-	[[nodiscard]] static Log& GetInstance() noexcept;
+	[[nodiscard]] static Log& GetInstance() noexcept {
+		return s_instance.get();
+	}
+
+	/// @brief Starts the registration of this logger with Windows event log in a thread pool thread.
+	/// @details Falls back to `RegisterEvents` if the queue for pending events or the thread pool work cannot be created.
+	void RegisterEventsAsync() noexcept;
+	/// @brief Check if a message is logged for the activity of the current thread.
+	/// @param priority The log priority.
+	/// @return `true` if the message is logged.
+	[[nodiscard]] static bool IsSampled(const Priority priority) noexcept {
+		if (priority < Priority::kVerbose || !ReadNoFence(&s_sampleMask)) {
+			[[likely]];
+			return true;
+		}
+		return IsActivitySampled();
+	}
+
+	/// @brief Check if the activity of the current thread is sampled.
+	/// @details The decision is cached for the current thread until the activity id changes.
+	/// @return `true` if messages of the activity are logged.
+	[[nodiscard]] static bool IsActivitySampled() noexcept;
 
 	/// @brief Registers this logger with Windows event log.
 	void RegisterEvents() noexcept;
+	/// @brief The thread pool callback which registers the logger and writes all queued events.
+	/// @param pContext A pointer to the logger.
+	static void CALLBACK RegisterEventsCallback(PTP_CALLBACK_INSTANCE /* pInstance */, void* pContext, PTP_WORK /* pWork */) noexcept;
 	/// @brief Unregisters this logger with Windows event log.
+	/// @details A registration which is still running is cancelled without waiting for it, because the logger might be
+	/// destroyed while holding the loader lock.
 	void UnregisterEvents() noexcept;
 
 	/// @brief Log a message.
@@ -418,6 +494,92 @@ private:
 		}
 	}
 
+	/// @brief Store a message which is not logged because of its priority in the buffer of the current thread.
+	/// @details Only messages with an `EVENT_DESCRIPTOR` and arguments which can be copied into a `LogData` are buffered.
+	/// @tparam M The type of the log message.
+	/// @tparam Args The type of the additional log arguments.
+	/// @param priority The log priority.
+	/// @param context Log message and source location.
+	/// @param args Additional log arguments.
+	template <internal::LogMessage M, typename... Args>
+	static void BufferMessage(const Priority priority, const internal::LogContext<M>& context, const Args&... args) noexcept {
+		if constexpr (internal::LogContext<M>::kIsEventDescriptor && (std::is_copy_constructible_v<std::decay_t<Args>> && ...)) {
+			try {
+				DoBufferMessage(priority, context, [&args...](_Inout_ LogData& logData) {
+					((logData << args), ...);
+				});
+			} catch (...) {
+				GetInstance().LogInternalError<M>(context);
+			}
+		}
+	}
+
+	/// @brief Handle a message which is not logged because of its priority or sampling.
+	/// @details The message is logged if it is enabled for the call site, else it is buffered if a `LogScope` is active.
+	/// @tparam M The type of the log message.
+	/// @tparam Args The type of the additional log arguments.
+	/// @param priority The log priority.
+	/// @param context Log message and source location.
+	/// @param args Additional log arguments.
+	template <internal::LogMessage M, typename... Args>
+	static void FilteredMessage(const Priority priority, const internal::LogContext<M>& context, const Args&... args) noexcept {
+		if (IsSiteEnabled(priority, context.GetSourceLocation())) {
+			[[unlikely]];
+			GetInstance().LogMessage(priority, context, args...);
+		} else if (s_scopeDepth) {
+			[[unlikely]];
+			BufferMessage(priority, context, args...);
+		}
+	}
+
+	/// @brief Handle an exception which is not logged because of its priority or sampling.
+	/// @details The exception is logged if it is enabled for the call site. Exceptions are never buffered because the
+	/// exception is no longer available when the buffer is written.
+	/// @note The function MUST be called from within a catch block.
+	/// @tparam M The type of the log message.
+	/// @tparam Args The type of the additional log arguments.
+	/// @param priority The log priority.
+	/// @param context Log message and source location.
+	/// @param args Additional log arguments.
+	template <internal::LogMessage M, typename... Args>
+	static void FilteredException(const Priority priority, const internal::LogContext<M>& context, const Args&... args) noexcept {
+		if (IsSiteEnabled(priority, context.GetSourceLocation())) {
+			[[unlikely]];
+			GetInstance().LogException(priority, context, args...);
+		}
+	}
+
+	/// @brief Check if a priority has been enabled at runtime for a call site.
+	/// @details While no rules exist, the check requires a single relaxed load.
+	/// @param priority The log priority.
+	/// @param sourceLocation The source location of the call site.
+	/// @return `true` if the message is logged.
+	[[nodiscard]] static bool IsSiteEnabled(const Priority priority, const source_location& sourceLocation) noexcept {
+		if (!s_hasSiteRules.load(std::memory_order_relaxed)) {
+			[[likely]];
+			return false;
+		}
+		return IsRegisteredSiteEnabled(priority, sourceLocation);
+	}
+
+	/// @brief Check if a priority has been enabled for a call site, registering the call site on its first hit.
+	/// @param priority The log priority.
+	/// @param sourceLocation The source location of the call site.
+	/// @return `true` if the message is logged.
+	[[nodiscard]] static bool IsRegisteredSiteEnabled(Priority priority, const source_location& sourceLocation) noexcept;
+
+	/// @brief Encode a message into the buffer of the current thread.
+	/// @param priority The log priority.
+	/// @param context Log message and source location.
+	/// @param encode A callable `Closure` to copy the log arguments into a `LogData` object.
+	static void DoBufferMessage(Priority priority, const internal::LogContext<const EVENT_DESCRIPTOR&>& context, const internal::ClosureExcept<void, LogData&>&& encode);
+
+	/// @brief Write all messages in the buffer of the current thread.
+	static void FlushBuffer() noexcept;
+
+	/// @brief Discard all messages in the buffer of the current thread.
+	static void DiscardBuffer() noexcept;
+
 	/// @brief Log an error which happened during logging.
 	/// @tparam M The type of the log message which caused the error.
 	/// @param loggedContext The `LogContext` from the call which caused the error.
@@ -506,7 +668,7 @@ private:
 	/// @param formatArgs The formatter arguments.
 	/// @param cause Log output for an exception.
 	/// @param sourceLocation The source location of the log message.
-	static void Print(Priority priority, _In_z_ const char* pattern, const LogFormatArgs& formatArgs, _In_z_ const char* cause, const std::source_location& sourceLocation);
+	static void Print(Priority priority, _In_z_ const char* pattern, const LogFormatArgs& formatArgs, _In_z_ const char* cause, const source_location& sourceLocation);
 
 	/// @brief Write an event to the Windows event log.
 	/// @param event The `EVENT_DESCRIPTOR` containing message, priority and other attributes.
@@ -553,11 +715,72 @@ private:
 	static constinit const Priority kLevel;  ///< @brief The log level of the logger.
 	static constinit const GUID kGuid;       ///<@ brief The `GUID` of the log provider for the Windows event log.
 
+	static constinit lazy<Log> s_instance;  ///< @brief The single logger instance.
+
+	/// @brief The mask for selecting sampled activities, `0` to log all activities.
+	static constinit inline volatile LONG s_sampleMask = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Configuration set at runtime.
+
+	/// @brief `true` if at least one rule for enabling call sites exists.
+	static constinit inline std::atomic<bool> s_hasSiteRules = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Configuration set at runtime.
+
+	/// @brief Events logged during registration, `nullptr` afterwards.
+	/// @details Static because the registration callback MUST be able to check the queue after the logger has been destroyed.
+	static constinit inline std::atomic<internal::PendingEvents*> s_pPendingEvents = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared by all threads.
+
 	/// @brief Stores event ids handled by the current thread to prevent infinite loops.
 	static thread_local inline USHORT s_logging[4] = {0};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
 
+	/// @brief The number of active `LogScope` objects of the current thread.
+	static thread_local inline std::uint32_t s_scopeDepth = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+private:
+	REGHANDLE m_handle = 0;             ///< @brief Handle of the windows event logger.
+	PTP_WORK m_registerWork = nullptr;  ///< @brief The thread pool work for registering the logger.
+
+	friend class LogScope;
+};
+
+/// @brief Buffers messages below the log level and writes them only if the scope fails.
+/// @details While a scope is active, messages with an `EVENT_DESCRIPTOR` which are not logged because of their priority
+/// are encoded in a buffer of the current thread. The buffer is written if an exception or a message with priority
+/// `Priority::kError` or higher is logged, `Flush` is called or the scope is left because of an exception. Else the
+/// buffer is discarded when the outermost scope ends. Nested scopes share the buffer of the outermost scope.
+/// @remarks String messages and exceptions are not buffered. If the buffer is full, the oldest messages are overwritten.
+class LogScope final {
+public:
+	/// @brief Starts buffering messages for the current thread.
+	[[nodiscard]] LogScope() noexcept
+	    : m_uncaughtExceptions(std::uncaught_exceptions()) {
+		++Log::s_scopeDepth;
+	}
+
+	LogScope(const LogScope&) = delete;
+	LogScope(LogScope&&) = delete;
+
+	/// @brief Writes the buffered messages if the scope is left because of an exception, else discards them when the
+	/// outermost scope ends.
+	~LogScope() noexcept {
+		if (std::uncaught_exceptions() > m_uncaughtExceptions) {
+			[[unlikely]];
+			Log::FlushBuffer();
+		}
+		if (!--Log::s_scopeDepth) {
+			Log::DiscardBuffer();
+		}
+	}
+
+public:
+	LogScope& operator=(const LogScope&) = delete;
+	LogScope& operator=(LogScope&&) = delete;
+
+public:
+	/// @brief Write all buffered messages.
+	void Flush() noexcept {
+		Log::FlushBuffer();
+	}
+
 private:
-	REGHANDLE m_handle = 0;  ///< @brief Handle of the windows event logger.
+	int m_uncaughtExceptions;  ///< @brief The number of uncaught exceptions when the scope was created.
 };
 
 extern template void Log::LogInternalError(const internal::LogContext<const EVENT_DESCRIPTOR&>&) noexcept;
@@ -29,6 +29,8 @@ limitations under the License.
 #include <wincodec.h>
 #include <wtypes.h>
 
+#include <algorithm>
+#include <array>
 #include <cassert>
 #include <concepts>
 #include <cstddef>
@@ -38,7 +40,13 @@ limitations under the License.
 #include <string_view>
 #include <type_traits>
 #include <utility>
-#include <vector>
+
+#ifndef M3C_LOGARGS_SIZE
+/// @brief The number of log arguments which are stored without allocation.
+/// @details Defined as a macro to allow redefinition for different use cases.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): Use macro to allow override in build settings.
+#define M3C_LOGARGS_SIZE 8
+#endif
 
 namespace m3c {
 
@@ -70,6 +78,88 @@ concept LogCustomTo = requires(T&& arg, Arguments& args) {
 	std::forward<T>(arg) >> args;
 };
 
+/// @brief A type of log message.
+/// @details Declared here instead of `Log.h` so that `exception.h` does not depend on the logger.
+/// @tparam T The actual type of the log message.
+template <typename T>
+concept LogMessage = AnyOf<T, const EVENT_DESCRIPTOR&, const char*>;
+
+/// @brief A list of log arguments which stores the first `M3C_LOGARGS_SIZE` elements without allocation.
+/// @details If the inline storage is full, the elements are moved to the heap and the capacity is doubled.
+/// @tparam T The type of the elements.
+template <typename T>
+class LogArgList final {
+public:
+	[[nodiscard]] LogArgList() noexcept = default;
+	LogArgList(const LogArgList&) = delete;
+	LogArgList(LogArgList&&) = delete;
+	~LogArgList() noexcept = default;
+
+public:
+	LogArgList& operator=(const LogArgList&) = delete;
+	LogArgList& operator=(LogArgList&&) = delete;
+
+public:
+	/// @brief Append an element.
+	/// @tparam Args The types of the constructor arguments.
+	/// @param args The constructor arguments.
+	/// @return A reference to the new element.
+	template <typename... Args>
+	T& emplace_back(Args&&... args) {
+		if (m_size == m_capacity) {
+			[[unlikely]];
+			Grow();
+		}
+		T& element = m_pData[m_size] = T(std::forward<Args>(args)...);
+		++m_size;
+		return element;
+	}
+
+	/// @brief Get the elements.
+	/// @return A pointer to the first element.
+	[[nodiscard]] constexpr T* data() noexcept {
+		return m_pData;
+	}
+
+	/// @brief Get the elements.
+	/// @return A pointer to the first element.
+	[[nodiscard]] constexpr const T* data() const noexcept {
+		return m_pData;
+	}
+
+	/// @brief Get a single element.
+	/// @param index The index of the element.
+	/// @return A reference to the element.
+	[[nodiscard]] constexpr const T& operator[](const std::size_t index) const noexcept {
+		assert(index < m_size);
+		return m_pData[index];
+	}
+
+	/// @brief Get the number of elements.
+	/// @return The number of elements.
+	[[nodiscard]] constexpr std::size_t size() const noexcept {
+		return m_size;
+	}
+
+private:
+	/// @brief Double the capacity by moving the elements to a new heap buffer.
+	void Grow() {
+		const std::size_t capacity = m_capacity * 2;
+		std::unique_ptr<T[]> heap = std::make_unique_for_overwrite<T[]>(capacity);  // NOLINT(cppcoreguidelines-avoid-c-arrays): Buffer of unknown size.
+		std::copy_n(m_pData, m_size, heap.get());
+		m_pData = heap.get();
+		m_heap = std::move(heap);
+		m_capacity = capacity;
+	}
+
+private:
+	std::array<T, M3C_LOGARGS_SIZE> m_inline;   ///< @brief The inline storage for the first elements.
+	std::unique_ptr<T[]> m_heap;                // NOLINT(cppcoreguidelines-avoid-c-arrays): The heap storage if there are more elements than fit inline.
+	T* m_pData = m_inline.data();               ///< @brief The current storage, either inline or on the heap.
+	std::size_t m_size = 0;                     ///< @brief The number of elements.
+	std::size_t m_capacity = M3C_LOGARGS_SIZE;  ///< @brief The number of elements which fit into the current storage.
+};
+
 
 /// @brief Base class for a container for arguments to `std::format`.
 class LogFormatArgsBase {
@@ -192,8 +282,8 @@ public:
 	}
 
 private:
-	std::vector<fmt::format_args::format_arg> m_args;  ///< @brief References to the formatter arguments.
-	fmt::detail::dynamic_arg_list m_backingStore;      ///< @brief The backing store for formatter arguments.
+	LogArgList<fmt::format_args::format_arg> m_args;  ///< @brief References to the formatter arguments.
+	fmt::detail::dynamic_arg_list m_backingStore;     ///< @brief The backing store for formatter arguments.
 };
 
 
@@ -306,7 +396,7 @@ public:
 	}
 
 private:
-	std::vector<EVENT_DATA_DESCRIPTOR> m_args;     ///< @brief The event arguments.
+	LogArgList<EVENT_DATA_DESCRIPTOR> m_args;      ///< @brief The event arguments.
 	fmt::detail::dynamic_arg_list m_backingStore;  ///< @brief The backing store for event arguments.
 };
 
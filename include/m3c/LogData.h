@@ -378,10 +378,11 @@ private:
 		    .size = sizeof(T),
 		    .addEventData = internal::logdata::AddLogArgs<LogEventArgs, T>,
 		    .addFormatArgs = internal::logdata::AddLogArgs<LogFormatArgs, T>};
-		return static_cast<T*>(WriteCustomType<true, true>(&kFunctionTable));
+		return static_cast<T*>(WriteCustomType<true, true, true>(&kFunctionTable));
 	}
 
 	/// @brief Reserve space for a custom, but not trivially copyable type in the argument buffer.
+	/// @details If `is_trivially_relocatable` is specialized for @p T, moving the buffer uses `std::memcpy` only.
 	/// @tparam T The type of the argument.
 	/// @return The address where the type MUST be constructed by the caller.
 	template <typename T>
@@ -401,7 +402,7 @@ private:
 			    internal::logdata::Copy<T>,
 			    internal::logdata::Move<T>,
 			};
-			return static_cast<T*>(WriteCustomType<false, true>(&kFunctionTable));
+			return static_cast<T*>(WriteCustomType<false, true, is_trivially_relocatable_v<T>>(&kFunctionTable));
 		} else {
 			constexpr static FunctionTableNonTrivial kFunctionTable{
 			    {.align = alignof(T),
@@ -409,7 +410,7 @@ private:
 			     .addEventData = internal::logdata::AddLogArgs<LogEventArgs, T>,
 			     .addFormatArgs = internal::logdata::AddLogArgs<LogFormatArgs, T>},
 			    internal::logdata::Destruct<T>};
-			return static_cast<T*>(WriteCustomType<false, false>(&kFunctionTable));
+			return static_cast<T*>(WriteCustomType<false, false, is_trivially_relocatable_v<T>>(&kFunctionTable));
 		}
 	}
 
@@ -418,9 +419,10 @@ private:
 	/// required and finally the bytes of the object.
 	/// @tparam kTriviallyCopyable `true` if the type is trivially copyable.
 	/// @tparam kNoThrowConstructible `true` if the type is no-throw constructible.
+	/// @tparam kTriviallyRelocatable `true` if the type can be moved using `std::memcpy`.
 	/// @param pFunctionTable A pointer to the `FunctionTable` or a derived type.
 	/// @return A pointer to the location where the custom type MUST be created.
-	template <bool kTriviallyCopyable, bool kNoThrowConstructible>
+	template <bool kTriviallyCopyable, bool kNoThrowConstructible, bool kTriviallyRelocatable>
 	[[nodiscard]] _Ret_notnull_ void* WriteCustomType(_In_ const FunctionTable* __restrict pFunctionTable);
 
 private:
@@ -439,7 +441,7 @@ private:
 	/// Not using a union because that would add unwanted padding.
 	/// @copyright Same as `NanoLogLine::m_stack_buffer` from NanoLog.
 	std::byte m_stackBuffer[M3C_LOGDATA_SIZE  // target size
-	                        - sizeof(bool)    // m_hasNonTriviallyCopyable
+	                        - sizeof(bool)    // bit fields m_hasHeapBuffer, m_hasNonTriviallyCopyable, m_hasNonTriviallyRelocatable
 	                        - sizeof(Size)    // m_used
 	];
 	static_assert(sizeof(m_stackBuffer) >= sizeof(HeapBufferInfo));
@@ -448,6 +450,8 @@ private:
 	bool m_hasHeapBuffer : 1 = false;
 	/// @brief `true` if at least one argument needs special handling on buffer operations. @hideinitializer
 	bool m_hasNonTriviallyCopyable : 1 = false;
+	/// @brief `true` if at least one argument cannot be moved using `std::memcpy`. @hideinitializer
+	bool m_hasNonTriviallyRelocatable : 1 = false;
 
 	/// @brief The number of bytes used in the buffer.
 	/// @copyright Same as `NanoLogLine::m_bytes_used` from NanoLog. @hideinitializer
@@ -0,0 +1,246 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/finally.h>
+#include <m3c/mpmc_queue.h>
+#include <m3c/mutex.h>
+
+#include <windows.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace m3c {
+
+/// @brief A bounded channel for handing over elements between threads.
+/// @details Elements are stored in a `mpmc_queue`. Blocking operations spin for a short time and then park the thread
+/// on a `condition_variable`. The mutex is only used by threads which have to wait.
+/// @tparam T The type of the elements.
+template <typename T>
+class channel final {
+public:
+	/// @brief Creates a new channel.
+	/// @param capacity The capacity of the channel. The value is rounded up to the next power of two.
+	[[nodiscard]] explicit channel(const std::size_t capacity)
+	    : m_queue(capacity) {
+		// empty
+	}
+
+	channel(const channel&) = delete;
+	channel(channel&&) = delete;
+	~channel() noexcept = default;
+
+public:
+	channel& operator=(const channel&) = delete;
+	channel& operator=(channel&&) = delete;
+
+public:
+	/// @brief Get the maximum number of elements in the channel.
+	/// @return The capacity of the channel.
+	[[nodiscard]] std::size_t capacity() const noexcept {
+		return m_queue.capacity();
+	}
+
+	/// @brief Add an element, waiting until there is room in the channel.
+	/// @param value The value to add.
+	void push(T&& value) {
+		for (std::uint32_t spin = 0; spin < kSpinCount; ++spin) {
+			if (m_queue.try_push(std::move(value))) {
+				[[likely]];
+				NotifyConsumers(1);
+				return;
+			}
+			YieldProcessor();
+		}
+
+		{
+			scoped_lock lock(m_mutex);
+			m_waitingProducers.fetch_add(1);
+			const auto waiting = finally([this]() noexcept {
+				m_waitingProducers.fetch_sub(1);
+			});
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			m_notFull.wait(lock, [this, &value] {
+				return m_queue.try_push(std::move(value));
+			});
+		}
+		NotifyConsumers(1);
+	}
+
+	/// @brief Add a copy of an element, waiting until there is room in the channel.
+	/// @param value The value to add.
+	void push(const T& value) {
+		push(T(value));
+	}
+
+	/// @brief Add an element if there is room in the channel.
+	/// @param value The value to add.
+	/// @return `true` if the element was added, `false` if the channel is full.
+	[[nodiscard]] bool try_push(T&& value) {
+		if (m_queue.try_push(std::move(value))) {
+			NotifyConsumers(1);
+			return true;
+		}
+		return false;
+	}
+
+	/// @brief Add a copy of an element if there is room in the channel.
+	/// @param value The value to add.
+	/// @return `true` if the element was added, `false` if the channel is full.
+	[[nodiscard]] bool try_push(const T& value) {
+		if (m_queue.try_push(value)) {
+			NotifyConsumers(1);
+			return true;
+		}
+		return false;
+	}
+
+	/// @brief Remove an element, waiting until the channel is not empty.
+	/// @return The element.
+	[[nodiscard]] T pop() {
+		for (std::uint32_t spin = 0; spin < kSpinCount; ++spin) {
+			if (std::optional<T> value = m_queue.try_pop(); value) {
+				[[likely]];
+				NotifyProducers(1);
+				return std::move(*value);
+			}
+			YieldProcessor();
+		}
+
+		std::optional<T> value;
+		{
+			scoped_lock lock(m_mutex);
+			m_waitingConsumers.fetch_add(1);
+			const auto waiting = finally([this]() noexcept {
+				m_waitingConsumers.fetch_sub(1);
+			});
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			m_notEmpty.wait(lock, [this, &value] {
+				value = m_queue.try_pop();
+				return value.has_value();
+			});
+		}
+		NotifyProducers(1);
+		return std::move(*value);
+	}
+
+	/// @brief Remove an element if the channel is not empty.
+	/// @return The element or `std::nullopt` if the channel is empty.
+	[[nodiscard]] std::optional<T> try_pop() {
+		std::optional<T> value = m_queue.try_pop();
+		if (value) {
+			NotifyProducers(1);
+		}
+		return value;
+	}
+
+	/// @brief Remove up to @p count elements, waiting until the channel is not empty.
+	/// @details The function waits for the first element only. Afterwards, it takes all available elements up to @p count.
+	/// @tparam OutputIt The type of the output iterator.
+	/// @param out An output iterator which receives the elements.
+	/// @param count The maximum number of elements to remove.
+	/// @return The number of elements removed.
+	template <std::output_iterator<T> OutputIt>
+	std::size_t pop_n(OutputIt out, const std::size_t count) {
+		if (!count) {
+			[[unlikely]];
+			return 0;
+		}
+		*out = pop();
+		++out;
+		return 1 + Drain(std::move(out), count - 1);
+	}
+
+	/// @brief Remove up to @p count elements if the channel is not empty.
+	/// @tparam OutputIt The type of the output iterator.
+	/// @param out An output iterator which receives the elements.
+	/// @param count The maximum number of elements to remove.
+	/// @return The number of elements removed.
+	template <std::output_iterator<T> OutputIt>
+	[[nodiscard]] std::size_t try_pop_n(OutputIt out, const std::size_t count) {
+		return Drain(std::move(out), count);
+	}
+
+private:
+	/// @brief Remove all available elements up to @p count without waiting.
+	/// @tparam OutputIt The type of the output iterator.
+	/// @param out An output iterator which receives the elements.
+	/// @param count The maximum number of elements to remove.
+	/// @return The number of elements removed.
+	template <typename OutputIt>
+	std::size_t Drain(OutputIt out, const std::size_t count) {
+		std::size_t n = 0;
+		for (; n < count; ++n) {
+			std::optional<T> value = m_queue.try_pop();
+			if (!value) {
+				break;
+			}
+			*out = std::move(*value);
+			++out;
+		}
+		NotifyProducers(n);
+		return n;
+	}
+
+	/// @brief Wake up threads waiting in `push`.
+	/// @param count The number of elements removed from the queue.
+	void NotifyProducers(const std::size_t count) noexcept {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (count && m_waitingProducers.load(std::memory_order_relaxed)) {
+			[[unlikely]];
+			scoped_lock lock(m_mutex);
+			if (count == 1) {
+				m_notFull.notify_one();
+			} else {
+				m_notFull.notify_all();
+			}
+		}
+	}
+
+	/// @brief Wake up threads waiting in `pop`.
+	/// @param count The number of elements added to the queue.
+	void NotifyConsumers(const std::size_t count) noexcept {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (count && m_waitingConsumers.load(std::memory_order_relaxed)) {
+			[[unlikely]];
+			scoped_lock lock(m_mutex);
+			if (count == 1) {
+				m_notEmpty.notify_one();
+			} else {
+				m_notEmpty.notify_all();
+			}
+		}
+	}
+
+private:
+	static constexpr std::uint32_t kSpinCount = 64;  ///< @brief The number of attempts before a thread is parked.
+
+	mpmc_queue<T> m_queue;                             ///< @brief The elements.
+	mutex m_mutex;                                     ///< @brief The mutex for waiting threads.
+	condition_variable m_notEmpty;                     ///< @brief Signaled when elements have been added.
+	condition_variable m_notFull;                      ///< @brief Signaled when elements have been removed.
+	std::atomic<std::uint32_t> m_waitingConsumers = 0;  ///< @brief The number of threads waiting in `pop`.
+	std::atomic<std::uint32_t> m_waitingProducers = 0;  ///< @brief The number of threads waiting in `push`.
+};
+
+}  // namespace m3c
@@ -19,6 +19,9 @@ limitations under the License.
 
 #include <m3c/LogArgs.h>
 #include <m3c/LogData.h>
+#include <m3c/finally.h>
+#include <m3c/leak_tracker.h>
+#include <m3c/source_location.h>
 
 #include <fmt/format.h>
 
@@ -27,6 +30,7 @@ limitations under the License.
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <utility>
 
 namespace m3c {
 
@@ -79,16 +83,18 @@ public:
 
 	/// @brief Transfer ownership of an existing pointer.
 	/// @param p The native pointer.
-	[[nodiscard]] constexpr explicit com_heap_ptr(_In_opt_ T* const p) noexcept
+	/// @param location The location where ownership is acquired, used by `leak_tracker`.
+	[[nodiscard]] constexpr explicit com_heap_ptr(_In_opt_ T* const p, const std::source_location& location = std::source_location::current()) noexcept
 	    : m_ptr(p) {
-		// empty
+		leak_tracker::track(m_ptr, location);
 	}
 
 	/// @brief Allocate and own a new memory block.
 	/// @param count The size of the memory block in number of @p T elements.
-	[[nodiscard]] explicit com_heap_ptr(const std::size_t count)
+	/// @param location The location where the memory is allocated, used by `leak_tracker`.
+	[[nodiscard]] explicit com_heap_ptr(const std::size_t count, const std::source_location& location = std::source_location::current())
 	    : m_ptr(static_cast<T*>(allocate(count, sizeof(T)))) {
-		// empty
+		leak_tracker::track(m_ptr, location);
 	}
 
 	[[nodiscard]] com_heap_ptr(const com_heap_ptr&) = delete;
@@ -96,7 +102,7 @@ public:
 	/// @brief Transfers ownership.
 	/// @param ptr Another `com_heap_ptr`.
 	[[nodiscard]] constexpr com_heap_ptr(com_heap_ptr&& ptr) noexcept
-	    : m_ptr(ptr.release()) {
+	    : m_ptr(std::exchange(ptr.m_ptr, nullptr)) {
 		// empty
 	}
 
@@ -113,7 +119,8 @@ public:
 	/// @return This instance.
 	com_heap_ptr& operator=(com_heap_ptr&& ptr) noexcept {
 		deallocate(m_ptr);
-		m_ptr = ptr.release();
+		// the memory remains tracked with its original location
+		m_ptr = std::exchange(ptr.m_ptr, nullptr);
 		return *this;
 	}
 
@@ -175,12 +182,19 @@ public:
 	[[nodiscard]] constexpr _Ret_maybenull_ T* release() noexcept {
 		T* const p = m_ptr;
 		m_ptr = nullptr;
+		leak_tracker::untrack(p);
 		return p;
 	}
 
 	/// @brief Change the size of the allocated memory block.
 	/// @param count The new size of the memory block in number of @a T elements.
-	void realloc(const std::size_t count) {
+	/// @param location The location where the memory is reallocated, used by `leak_tracker`.
+	void realloc(const std::size_t count, const std::source_location& location = std::source_location::current()) {
+		// untrack first because the old address might be reused by another thread as soon as it has been freed
+		leak_tracker::untrack(m_ptr);
+		const auto track = finally([this, &location]() noexcept {
+			leak_tracker::track(m_ptr, location);
+		});
 		m_ptr = static_cast<T*>(reallocate(m_ptr, count, sizeof(T)));
 	}
 
@@ -0,0 +1,308 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/com_heap_ptr.h>
+#include <m3c/fwd.h>
+
+#include <sal.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace m3c {
+
+namespace internal {
+
+/// @brief An allocator for use with `com_heap_vector`.
+/// @details An allocator provides static functions in the style of `malloc`, `realloc` and `free`. `allocate` and
+/// `reallocate` MUST throw an exception if no memory is available.
+/// @tparam T The type of the allocator.
+template <typename T>
+concept HeapAllocator = requires(void* ptr, std::size_t count, std::size_t size) {
+	{ T::allocate(count, size) } -> std::same_as<void*>;
+	{ T::reallocate(ptr, count, size) } -> std::same_as<void*>;
+	{ T::deallocate(ptr) } noexcept;
+};
+
+/// @brief Allocator using `CoTaskMemAlloc`, `CoTaskMemRealloc` and `CoTaskMemFree`.
+struct CoTaskMemAllocator final : private com_heap_ptr_base {
+	CoTaskMemAllocator() = delete;
+
+	using com_heap_ptr_base::allocate;
+	using com_heap_ptr_base::deallocate;
+	using com_heap_ptr_base::reallocate;
+};
+
+}  // namespace internal
+
+
+/// @brief A growable array in memory managed using `CoTaskMemAlloc` and `CoTaskMemFree`.
+/// @details The vector tracks size and capacity and grows geometrically, so that appending elements runs in amortized
+/// constant time. Use `release` to hand the array to callers which expect a pointer allocated by `CoTaskMemAlloc`,
+/// e.g. for out parameters of COM methods. Elements are moved by `CoTaskMemRealloc` and never destroyed, so @p T MUST
+/// be trivially copyable, e.g. a C type like `PROPVARIANT`.
+/// @tparam T The type of the elements.
+/// @tparam Allocator The strategy for allocating memory, MUST satisfy `HeapAllocator`, defaults to `internal::CoTaskMemAllocator` (see `fwd.h`).
+template <typename T, typename Allocator>
+class com_heap_vector final {
+	static_assert(std::is_trivially_copyable_v<T>, "elements must be trivially copyable");
+	static_assert(internal::HeapAllocator<Allocator>, "Allocator must provide allocate, reallocate and noexcept deallocate");
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+
+public:
+	/// @brief Creates an empty instance.
+	[[nodiscard]] constexpr com_heap_vector() noexcept = default;
+
+	com_heap_vector(const com_heap_vector&) = delete;
+
+	/// @brief Transfers ownership.
+	/// @param vector Another `com_heap_vector`.
+	[[nodiscard]] constexpr com_heap_vector(com_heap_vector&& vector) noexcept
+	    : m_ptr(std::exchange(vector.m_ptr, nullptr))
+	    , m_size(std::exchange(vector.m_size, 0))
+	    , m_capacity(std::exchange(vector.m_capacity, 0)) {
+		// empty
+	}
+
+	/// @brief Frees the memory.
+	~com_heap_vector() noexcept {
+		Allocator::deallocate(m_ptr);
+	}
+
+public:
+	com_heap_vector& operator=(const com_heap_vector&) = delete;
+
+	/// @brief Transfers ownership.
+	/// @param vector Another `com_heap_vector`.
+	/// @return This instance.
+	com_heap_vector& operator=(com_heap_vector&& vector) noexcept {
+		Allocator::deallocate(m_ptr);
+		m_ptr = std::exchange(vector.m_ptr, nullptr);
+		m_size = std::exchange(vector.m_size, 0);
+		m_capacity = std::exchange(vector.m_capacity, 0);
+		return *this;
+	}
+
+	/// @brief Access an element.
+	/// @param index The index of the element.
+	/// @return The element.
+	[[nodiscard]] T& operator[](const std::size_t index) noexcept {
+		return m_ptr[index];
+	}
+
+	/// @brief Access an element.
+	/// @param index The index of the element.
+	/// @return The element.
+	[[nodiscard]] const T& operator[](const std::size_t index) const noexcept {
+		return m_ptr[index];
+	}
+
+public:
+	/// @brief Get an iterator to the first element.
+	/// @return An iterator to the first element.
+	[[nodiscard]] T* begin() noexcept {
+		return m_ptr;
+	}
+
+	/// @brief Get an iterator to the first element.
+	/// @return An iterator to the first element.
+	[[nodiscard]] const T* begin() const noexcept {
+		return m_ptr;
+	}
+
+	/// @brief Get an iterator past the last element.
+	/// @return An iterator past the last element.
+	[[nodiscard]] T* end() noexcept {
+		return m_ptr + m_size;
+	}
+
+	/// @brief Get an iterator past the last element.
+	/// @return An iterator past the last element.
+	[[nodiscard]] const T* end() const noexcept {
+		return m_ptr + m_size;
+	}
+
+	/// @brief Get the array.
+	/// @return The pointer to the first element or `nullptr` if no memory has been allocated.
+	[[nodiscard]] _Ret_maybenull_ T* data() noexcept {
+		return m_ptr;
+	}
+
+	/// @brief Get the array.
+	/// @return The pointer to the first element or `nullptr` if no memory has been allocated.
+	[[nodiscard]] _Ret_maybenull_ const T* data() const noexcept {
+		return m_ptr;
+	}
+
+	/// @brief Get the number of elements.
+	/// @return The number of elements.
+	[[nodiscard]] std::size_t size() const noexcept {
+		return m_size;
+	}
+
+	/// @brief Get the number of elements for which memory has been allocated.
+	/// @return The capacity.
+	[[nodiscard]] std::size_t capacity() const noexcept {
+		return m_capacity;
+	}
+
+	/// @brief Check if the vector is empty.
+	/// @return `true` if the vector contains no elements.
+	[[nodiscard]] bool empty() const noexcept {
+		return m_size == 0;
+	}
+
+	/// @brief Get the maximum number of elements.
+	/// @return The maximum number of elements.
+	[[nodiscard]] static constexpr std::size_t max_size() noexcept {
+		return std::numeric_limits<std::size_t>::max() / sizeof(T);
+	}
+
+	/// @brief Allocate memory for at least @p count elements.
+	/// @param count The number of elements.
+	void reserve(const std::size_t count) {
+		if (count > m_capacity) {
+			Reallocate(count);
+		}
+	}
+
+	/// @brief Reduce the capacity to the number of elements.
+	void shrink_to_fit() {
+		if (m_capacity == m_size) {
+			return;
+		}
+		if (!m_size) {
+			Allocator::deallocate(m_ptr);
+			m_ptr = nullptr;
+			m_capacity = 0;
+			return;
+		}
+		Reallocate(m_size);
+	}
+
+	/// @brief Remove all elements, the capacity is not changed.
+	void clear() noexcept {
+		m_size = 0;
+	}
+
+	/// @brief Change the number of elements. New elements are value-initialized.
+	/// @param count The new number of elements.
+	void resize(const std::size_t count) {
+		if (count > m_capacity) {
+			Reallocate(GetGrowth(count));
+		}
+		if (count > m_size) {
+			std::uninitialized_value_construct(m_ptr + m_size, m_ptr + count);
+		}
+		m_size = count;
+	}
+
+	/// @brief Construct an element at the end.
+	/// @tparam Args The types of the constructor arguments.
+	/// @param args The arguments for the constructor of the element.
+	/// @return The new element.
+	template <typename... Args>
+	T& emplace_back(Args&&... args) {
+		if (m_size == m_capacity) {
+			// construct before growing because args might reference an element
+			T value(std::forward<Args>(args)...);
+			Reallocate(GetGrowth(m_size + 1));
+			return *std::construct_at(m_ptr + m_size++, value);
+		}
+		return *std::construct_at(m_ptr + m_size++, std::forward<Args>(args)...);
+	}
+
+	/// @brief Add an element at the end.
+	/// @param value The value to add.
+	void push_back(const T& value) {
+		emplace_back(value);
+	}
+
+	/// @brief Remove the last element.
+	void pop_back() noexcept {
+		--m_size;
+	}
+
+	/// @brief Release ownership of the array.
+	/// @note The responsibility for freeing the memory is transferred to the caller, e.g. using `CoTaskMemFree`.
+	/// @return The array or `nullptr` if no memory has been allocated.
+	[[nodiscard]] _Ret_maybenull_ T* release() noexcept {
+		m_size = 0;
+		m_capacity = 0;
+		return std::exchange(m_ptr, nullptr);
+	}
+
+	/// @brief Swap two objects.
+	/// @param vector The other `com_heap_vector`.
+	constexpr void swap(com_heap_vector& vector) noexcept {
+		std::swap(m_ptr, vector.m_ptr);
+		std::swap(m_size, vector.m_size);
+		std::swap(m_capacity, vector.m_capacity);
+	}
+
+private:
+	/// @brief Get the new capacity for growing.
+	/// @param count The required number of elements.
+	/// @return The new capacity.
+	[[nodiscard]] std::size_t GetGrowth(const std::size_t count) const noexcept {
+		const std::size_t geometric = m_capacity > max_size() / 2 ? max_size() : std::max<std::size_t>(m_capacity * 2, kMinimumCapacity);
+		return std::max(count, geometric);
+	}
+
+	/// @brief Change the capacity.
+	/// @param capacity The new capacity.
+	void Reallocate(const std::size_t capacity) {
+		m_ptr = static_cast<T*>(Allocator::reallocate(m_ptr, capacity, sizeof(T)));
+		m_capacity = capacity;
+	}
+
+private:
+	static constexpr std::size_t kMinimumCapacity = 4;  ///< @brief The capacity of the first allocation.
+
+	T* m_ptr = nullptr;          ///< @brief The array.
+	std::size_t m_size = 0;      ///< @brief The number of elements.
+	std::size_t m_capacity = 0;  ///< @brief The number of elements for which memory has been allocated.
+};
+
+/// @brief Swap function.
+/// @tparam T The type of the elements.
+/// @tparam Allocator The strategy for allocating memory.
+/// @param vector A `com_heap_vector` object.
+/// @param oth Another `com_heap_vector` object.
+template <typename T, typename Allocator>
+constexpr void swap(com_heap_vector<T, Allocator>& vector, com_heap_vector<T, Allocator>& oth) noexcept {
+	vector.swap(oth);
+}
+
+}  // namespace m3c
@@ -0,0 +1,148 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/Handle.h>
+
+#include <windows.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace m3c {
+
+/// @brief An entry returned by `directory_iterator`.
+/// @details The name references the buffer of the iterator and is only valid until the iterator is incremented.
+struct directory_entry final {
+	std::wstring_view name;      ///< @brief The name of the file, not null-terminated.
+	DWORD attributes;            ///< @brief The file attributes.
+	std::uint64_t size;          ///< @brief The size of the file in bytes.
+	std::int64_t lastWriteTime;  ///< @brief The time of the last write in `FILETIME` units.
+	std::uint64_t fileId;        ///< @brief The file id which is unique on the volume.
+
+	/// @brief Check if the entry is a directory.
+	/// @return `true` if the entry is a directory.
+	[[nodiscard]] bool is_directory() const noexcept {
+		return (attributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+	}
+};
+
+/// @brief An input iterator over the entries of a directory.
+/// @details The entries are read in large batches into a buffer using `GetFileInformationByHandleEx`, one system call
+/// returns hundreds of entries. The names are not copied but reference the buffer which serves as an arena for all
+/// names of a batch. The entries `.` and `..` are skipped. As for `std::filesystem::directory_iterator`, all copies of
+/// an iterator share the same state.
+class directory_iterator final {
+public:
+	using iterator_category = std::input_iterator_tag;
+	using value_type = directory_entry;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const directory_entry*;
+	using reference = const directory_entry&;
+
+public:
+	/// @brief Creates the end iterator.
+	[[nodiscard]] directory_iterator() noexcept = default;
+
+	/// @brief Open a directory and read the first entry.
+	/// @param path The path of the directory.
+	[[nodiscard]] explicit directory_iterator(_In_z_ const wchar_t* path);
+
+	/// @brief Read the first entry of an open directory.
+	/// @param directory A directory opened with `FILE_LIST_DIRECTORY` access and `FILE_FLAG_BACKUP_SEMANTICS`.
+	[[nodiscard]] explicit directory_iterator(Handle&& directory);
+
+	[[nodiscard]] directory_iterator(const directory_iterator&) noexcept = default;
+	[[nodiscard]] directory_iterator(directory_iterator&&) noexcept = default;
+	~directory_iterator() noexcept = default;
+
+public:
+	directory_iterator& operator=(const directory_iterator&) noexcept = default;
+	directory_iterator& operator=(directory_iterator&&) noexcept = default;
+
+	/// @brief Get the current entry.
+	/// @return The entry.
+	[[nodiscard]] const directory_entry& operator*() const noexcept;
+
+	/// @brief Get the current entry.
+	/// @return A pointer to the entry.
+	[[nodiscard]] const directory_entry* operator->() const noexcept {
+		return &**this;
+	}
+
+	/// @brief Move to the next entry.
+	/// @return This instance.
+	directory_iterator& operator++();
+
+	/// @brief Move to the next entry.
+	/// @details Other than for forward iterators, the result does not reference the previous entry.
+	void operator++(int) {
+		++*this;
+	}
+
+	/// @brief Compare two iterators.
+	/// @param oth Another iterator.
+	/// @return `true` if both iterators share the same state or both are end iterators.
+	[[nodiscard]] bool operator==(const directory_iterator& oth) const noexcept {
+		return m_pState == oth.m_pState;
+	}
+
+private:
+	struct State;
+
+	/// @brief Read the next entry into the state, resetting the iterator to the end when all entries have been read.
+	void Next();
+
+private:
+	std::shared_ptr<State> m_pState;  ///< @brief The shared state, `nullptr` for the end iterator.
+};
+
+/// @brief Support for range-based for loops.
+/// @param it An iterator.
+/// @return @p it.
+[[nodiscard]] inline directory_iterator begin(directory_iterator it) noexcept {
+	return it;
+}
+
+/// @brief Support for range-based for loops.
+/// @return The end iterator.
+[[nodiscard]] inline directory_iterator end(const directory_iterator&) noexcept {
+	return {};
+}
+
+/// @brief The type of the callback for `walk_directory`.
+/// @details The first argument is the path of the directory which contains the entry.
+using walk_callback = std::function<void(const std::wstring& directory, const directory_entry& entry)>;
+
+/// @brief Recursively enumerate all entries of a directory tree using multiple threads.
+/// @details Directories are scanned in parallel using a shared work queue. Reparse points are reported but not followed.
+/// Subdirectories which cannot be opened because access is denied or because they have been removed in the meantime are
+/// logged and skipped. If the callback or the enumeration throws an exception, the walk stops and the first exception is
+/// rethrown.
+/// @param root The path of the root directory.
+/// @param callback The callback which is called for every entry. The callback is called concurrently from different
+/// threads, but not for the same directory.
+/// @param threads The number of threads to use, `0` for the number of processors.
+void walk_directory(const std::wstring& root, const walk_callback& callback, std::uint32_t threads = 0);
+
+}  // namespace m3c
@@ -17,7 +17,7 @@ limitations under the License.
 /// @file
 #pragma once
 
-#include <m3c/Log.h>
+#include <m3c/LogArgs.h>
 #include <m3c/LogData.h>
 #include <m3c/source_location.h>
 
@@ -241,7 +241,7 @@ class DefaultContext {
 public:
 	/// @brief Create a new context. The unused parameter is required for automatic type creation.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr DefaultContext(Default /* unused */, const std::source_location& sourceLocation = std::source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
+	[[nodiscard]] constexpr DefaultContext(Default /* unused */, const source_location& sourceLocation = source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
 	    : m_sourceLocation(sourceLocation) {
 		// empty
 	}
@@ -249,7 +249,7 @@ public:
 protected:
 	/// @brief Constructor used by sub class.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr explicit DefaultContext(const std::source_location& sourceLocation) noexcept
+	[[nodiscard]] constexpr explicit DefaultContext(const source_location& sourceLocation) noexcept
 	    : m_sourceLocation(sourceLocation) {
 		// empty
 	}
@@ -267,12 +267,12 @@ public:
 public:
 	/// @brief Get the source location of the caller.
 	/// @return The source location.
-	[[nodiscard]] constexpr const std::source_location& GetSourceLocation() const noexcept {
+	[[nodiscard]] constexpr const source_location& GetSourceLocation() const noexcept {
 		return m_sourceLocation;
 	}
 
 private:
-	const std::source_location m_sourceLocation;  ///< @brief The source location.
+	const source_location m_sourceLocation;  ///< @brief The source location.
 };
 
 
@@ -285,14 +285,14 @@ public:
 	/// @brief Create a new context.
 	/// @param message The log message for the exception.
 	/// @param sourceLocation The source location.
-	[[nodiscard]] constexpr ExceptionContext(const M message, const std::source_location& sourceLocation = std::source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
+	[[nodiscard]] constexpr ExceptionContext(const M message, const source_location& sourceLocation = source_location::current()) noexcept  // NOLINT(google-explicit-constructor): Implicit conversion is intentional.
 	    : DefaultContext(sourceLocation)
 	    , m_message(message) {
 		// empty
 	}
 
 	/// @brief Prevent creation from rvalue event descriptors which might go out of scope.
-	[[nodiscard]] constexpr ExceptionContext(EVENT_DESCRIPTOR&&, const std::source_location& sourceLocation = std::source_location::current()) = delete;
+	[[nodiscard]] constexpr ExceptionContext(EVENT_DESCRIPTOR&&, const source_location& sourceLocation = source_location::current()) = delete;
 
 	ExceptionContext(const ExceptionContext&) = delete;
 	ExceptionContext(ExceptionContext&&) = delete;
@@ -371,7 +371,7 @@ public:
 public:
 	/// @brief Allow access to the source location from the context.
 	/// @return The source location.
-	[[nodiscard]] constexpr const std::source_location& GetSourceLocation() const noexcept {
+	[[nodiscard]] constexpr const source_location& GetSourceLocation() const noexcept {
 		return m_sourceLocation;
 	}
 
@@ -401,8 +401,8 @@ protected:
 	}
 
 private:
-	LogData m_logData;                      ///< @brief Additional information for logging.
-	std::source_location m_sourceLocation;  ///< @brief The source location where the exception happened.
+	LogData m_logData;                 ///< @brief Additional information for logging.
+	source_location m_sourceLocation;  ///< @brief The source location where the exception happened.
 
 	/// @brief The message to log.
 	/// @remarks `EVENT_DESCRIPTOR` is stored as a pointer to allow copy and move operations.
@@ -0,0 +1,136 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Forward declarations of the types of the library.
+/// @details Include this header instead of the full headers if a type is only used by reference or pointer, e.g. in
+/// function declarations. The header does not include `<windows.h>` or `{fmt}`.
+#pragma once
+
+#include <m3c/type_traits.h>
+
+#include <concepts>
+#include <cstdint>
+
+struct IUnknown;
+
+namespace m3c {
+
+//
+// Exceptions
+//
+
+class system_error;
+class windows_error;
+class rpc_error;
+class com_error;
+class com_invalid_argument_error;
+
+
+//
+// Logging and formatting
+//
+
+enum class Priority : unsigned char;  // same as UCHAR
+class Log;
+class LogScope;
+class LogData;
+class LogFormatArgs;
+class LogEventArgs;
+
+template <typename CharT>
+class fmt_encode;
+
+template <typename T>
+class fmt_ptr;
+
+class win32_error;
+class hresult;
+struct rpc_status;
+
+
+//
+// Memory
+//
+
+template <typename T>
+struct default_delete;
+
+template <typename T, typename Deleter = default_delete<T>>
+class unique_ptr;
+
+template <std::derived_from<IUnknown> T>
+class com_ptr;
+
+template <typename T>
+class com_heap_ptr;
+
+namespace internal {
+struct CoTaskMemAllocator;
+}  // namespace internal
+
+template <typename T, typename Allocator = internal::CoTaskMemAllocator>
+class com_heap_vector;
+
+
+//
+// Strings
+//
+
+template <std::uint16_t kSize, typename CharT>
+class basic_lazy_string;
+
+template <AnyOf<char, wchar_t> T>
+class basic_rpc_string;
+
+using rpc_string = basic_rpc_string<char>;
+using rpc_wstring = basic_rpc_string<wchar_t>;
+
+
+//
+// COM
+//
+
+class COM;
+class PropVariant;
+class Variant;
+
+
+//
+// Synchronization
+//
+
+class mutex;
+class once_flag;
+
+template <typename T>
+class lazy;
+
+template <typename T>
+class channel;
+
+
+//
+// I/O
+//
+
+class io_engine;
+class mapped_file;
+class mapped_view;
+class directory_iterator;
+struct directory_entry;
+
+}  // namespace m3c
@@ -0,0 +1,192 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/Handle.h>
+
+#include <windows.h>
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+
+namespace m3c {
+
+/// @brief The result of an asynchronous I/O operation.
+struct io_result final {
+	DWORD error;  ///< @brief `ERROR_SUCCESS` or the windows error code of the operation.
+	DWORD bytes;  ///< @brief The number of bytes transferred.
+};
+
+/// @brief An engine for asynchronous file I/O using an I/O completion port.
+/// @details Files MUST be opened using `FILE_FLAG_OVERLAPPED` and associated with the engine before use. Completions
+/// are dequeued in batches by `poll` or `run` and reported either to a callback or to an awaiting coroutine. Callbacks
+/// and coroutines run on the thread calling `poll` or `run`.
+class io_engine final {
+public:
+	/// @brief The type of the callback which receives the result of an operation.
+	using Callback = std::function<void(const io_result&)>;
+
+	class awaitable;
+
+public:
+	/// @brief Creates a new engine with its own completion port.
+	/// @param concurrency The maximum number of threads running concurrently on the port, `0` for the number of processors.
+	[[nodiscard]] explicit io_engine(DWORD concurrency = 0);
+
+	io_engine(const io_engine&) = delete;
+	io_engine(io_engine&&) = delete;
+
+	/// @brief Destroys the engine.
+	/// @warning All operations MUST have completed before the engine is destroyed.
+	~io_engine() noexcept = default;
+
+public:
+	io_engine& operator=(const io_engine&) = delete;
+	io_engine& operator=(io_engine&&) = delete;
+
+public:
+	/// @brief Associate a file with the completion port of the engine.
+	/// @details A file can only be associated with one completion port during its lifetime.
+	/// @param file A file opened using `FILE_FLAG_OVERLAPPED`.
+	void associate(const Handle& file);
+
+	/// @brief Start reading from a file.
+	/// @details Errors of the operation, including those reported synchronously by Windows, are passed to the callback.
+	/// @param file A file associated with this engine.
+	/// @param offset The offset in the file.
+	/// @param buffer The buffer which receives the data. The buffer MUST stay valid until the operation completes and
+	/// MUST NOT be larger than `MAXDWORD` bytes, else `std::length_error` is thrown.
+	/// @param callback The callback which receives the result.
+	void read(const Handle& file, std::uint64_t offset, std::span<std::byte> buffer, Callback callback);
+
+	/// @brief Start writing to a file.
+	/// @details Errors of the operation, including those reported synchronously by Windows, are passed to the callback.
+	/// @param file A file associated with this engine.
+	/// @param offset The offset in the file.
+	/// @param buffer The data to write. The buffer MUST stay valid until the operation completes and MUST NOT be larger
+	/// than `MAXDWORD` bytes, else `std::length_error` is thrown.
+	/// @param callback The callback which receives the result.
+	void write(const Handle& file, std::uint64_t offset, std::span<const std::byte> buffer, Callback callback);
+
+	/// @brief Read from a file in a coroutine.
+	/// @param file A file associated with this engine.
+	/// @param offset The offset in the file.
+	/// @param buffer The buffer which receives the data. The buffer MUST stay valid until the operation completes.
+	/// @return An object for use with `co_await` which returns an `io_result`.
+	[[nodiscard]] awaitable read_async(const Handle& file, std::uint64_t offset, std::span<std::byte> buffer) noexcept;
+
+	/// @brief Write to a file in a coroutine.
+	/// @param file A file associated with this engine.
+	/// @param offset The offset in the file.
+	/// @param buffer The data to write. The buffer MUST stay valid until the operation completes.
+	/// @return An object for use with `co_await` which returns an `io_result`.
+	[[nodiscard]] awaitable write_async(const Handle& file, std::uint64_t offset, std::span<const std::byte> buffer) noexcept;
+
+	/// @brief Dispatch completed operations.
+	/// @details If a callback throws an exception, the remaining callbacks of the batch are still run and the first
+	/// exception is rethrown afterwards.
+	/// @param timeout The maximum time to wait for the first completion. Negative values do not wait, values of
+	/// `INFINITE` or more wait forever.
+	/// @return The number of completed operations.
+	std::size_t poll(std::chrono::milliseconds timeout = std::chrono::milliseconds(0));
+
+	/// @brief Dispatch completed operations until no more operations are outstanding.
+	void run();
+
+	/// @brief Get the number of outstanding operations.
+	/// @return The number of operations which have been started but not yet dispatched.
+	[[nodiscard]] std::size_t pending() const noexcept {
+		return m_pending.load(std::memory_order_relaxed);
+	}
+
+private:
+	/// @brief Start an operation.
+	/// @param file A file associated with this engine.
+	/// @param offset The offset in the file.
+	/// @param pBuffer The buffer.
+	/// @param size The size of the buffer.
+	/// @param write `true` for writing, `false` for reading.
+	/// @param callback The callback which receives the result.
+	void Submit(const Handle& file, std::uint64_t offset, _In_reads_bytes_(size) void* pBuffer, DWORD size, bool write, Callback&& callback);
+
+private:
+	Handle m_port;                           ///< @brief The I/O completion port.
+	std::atomic<std::size_t> m_pending = 0;  ///< @brief The number of outstanding operations.
+};
+
+/// @brief An object for `co_await`-ing an asynchronous I/O operation of an `io_engine`.
+class io_engine::awaitable final {
+public:
+	/// @brief Creates a new object which starts the operation when awaited.
+	/// @param engine The engine.
+	/// @param file A file associated with @p engine.
+	/// @param offset The offset in the file.
+	/// @param buffer The buffer.
+	/// @param write `true` for writing, `false` for reading.
+	[[nodiscard]] awaitable(io_engine& engine, const Handle& file, const std::uint64_t offset, const std::span<std::byte> buffer, const bool write) noexcept
+	    : m_engine(engine)
+	    , m_file(file)
+	    , m_offset(offset)
+	    , m_buffer(buffer)
+	    , m_write(write) {
+		// empty
+	}
+
+public:
+	/// @brief The operation always runs asynchronously.
+	/// @return Always `false`.
+	[[nodiscard]] constexpr bool await_ready() const noexcept {
+		return false;
+	}
+
+	/// @brief Start the operation and resume @p handle on completion.
+	/// @param handle The awaiting coroutine.
+	void await_suspend(const std::coroutine_handle<> handle) {
+		Callback callback = [this, handle](const io_result& result) {
+			m_result = result;
+			handle.resume();
+		};
+		if (m_write) {
+			m_engine.write(m_file, m_offset, m_buffer, std::move(callback));
+		} else {
+			m_engine.read(m_file, m_offset, m_buffer, std::move(callback));
+		}
+	}
+
+	/// @brief Get the result.
+	/// @return The result of the operation.
+	[[nodiscard]] io_result await_resume() const noexcept {
+		return m_result;
+	}
+
+private:
+	io_engine& m_engine;                      ///< @brief The engine.
+	const Handle& m_file;                     ///< @brief The file.
+	std::uint64_t m_offset;                   ///< @brief The offset in the file.
+	std::span<std::byte> m_buffer;            ///< @brief The buffer.
+	bool m_write;                             ///< @brief `true` for writing, `false` for reading.
+	io_result m_result = {ERROR_SUCCESS, 0};  ///< @brief The result of the operation.
+};
+
+}  // namespace m3c
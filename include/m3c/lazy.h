@@ -0,0 +1,172 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <windows.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace m3c {
+
+/// @brief Same as `std::once_flag` but supports `constinit` and checks for completion using a single acquire load.
+/// @details Threads which have to wait for another thread running the initialization are parked using `WaitOnAddress`.
+/// @warning Recursive initialization from within the callable deadlocks.
+class once_flag final {
+public:
+	[[nodiscard]] constexpr once_flag() noexcept = default;
+	once_flag(const once_flag&) = delete;
+	once_flag(once_flag&&) = delete;
+	constexpr ~once_flag() noexcept = default;
+
+public:
+	once_flag& operator=(const once_flag&) = delete;
+	once_flag& operator=(once_flag&&) = delete;
+
+public:
+	/// @brief Check if the initialization has completed successfully.
+	/// @return `true` if the initialization has completed.
+	[[nodiscard]] bool is_done() const noexcept {
+		return ReadAcquire(&m_state) == kDone;
+	}
+
+private:
+	/// @brief Start the initialization or wait until another thread has finished it.
+	/// @return `true` if the calling thread MUST run the initialization and call `Leave` afterwards, `false` if the
+	/// initialization has already completed.
+	[[nodiscard]] bool Enter() noexcept;
+
+	/// @brief Finish the initialization and wake up waiting threads.
+	/// @param success `true` if the initialization has completed, `false` if it has failed and MUST be repeated.
+	void Leave(bool success) noexcept;
+
+private:
+	static constexpr LONG kInitial = 0;  ///< @brief The initialization has not yet been run.
+	static constexpr LONG kRunning = 1;  ///< @brief The initialization is currently running.
+	static constexpr LONG kDone = 2;     ///< @brief The initialization has completed.
+
+	volatile LONG m_state = kInitial;  ///< @brief The state of the initialization.
+
+	template <typename F>
+	friend void call_once(once_flag& flag, F&& f);
+};
+
+/// @brief Same as `std::call_once` but for `m3c::once_flag`.
+/// @details If @p f throws an exception, the flag is reset and the next caller runs the initialization again.
+/// @tparam F The type of the callable.
+/// @param flag The flag which protects the initialization.
+/// @param f The callable which is run exactly once.
+template <typename F>
+void call_once(once_flag& flag, F&& f) {
+	if (flag.is_done()) {
+		[[likely]];
+		return;
+	}
+	if (flag.Enter()) {
+		try {
+			std::invoke(std::forward<F>(f));
+		} catch (...) {
+			flag.Leave(false);
+			throw;
+		}
+		flag.Leave(true);
+	}
+}
+
+/// @brief A value which is constructed on first use in a thread-safe way.
+/// @details Other than a function-local `static` variable, an instance of `lazy` can be declared `constinit` and the
+/// access to an initialized value requires a single acquire load only. The value is destroyed with the `lazy` instance.
+/// @tparam T The type of the value. @p T MAY be incomplete where `lazy<T>` is declared.
+template <typename T>
+class lazy final {
+public:
+	/// @brief Creates a new instance without constructing the value.
+	[[nodiscard]] constexpr lazy() noexcept
+	    : m_empty() {
+		// empty
+	}
+
+	lazy(const lazy&) = delete;
+	lazy(lazy&&) = delete;
+
+	/// @brief Destroys the value if it has been constructed.
+	~lazy() noexcept {
+		static_assert(std::is_nothrow_destructible_v<T>, "destructor must not throw");
+		if (m_once.is_done()) {
+			std::destroy_at(&m_value);
+		}
+	}
+
+public:
+	lazy& operator=(const lazy&) = delete;
+	lazy& operator=(lazy&&) = delete;
+
+	/// @brief Get the value, constructing it if required.
+	/// @return The value.
+	[[nodiscard]] T& operator*() noexcept(std::is_nothrow_default_constructible_v<T>) {
+		return get();
+	}
+
+	/// @brief Get the value, constructing it if required.
+	/// @return A pointer to the value.
+	[[nodiscard]] T* operator->() noexcept(std::is_nothrow_default_constructible_v<T>) {
+		return &get();
+	}
+
+public:
+	/// @brief Get the value, using the default constructor if the value has not yet been constructed.
+	/// @return The value.
+	[[nodiscard]] T& get() noexcept(std::is_nothrow_default_constructible_v<T>) {
+		if (m_once.is_done()) {
+			[[likely]];
+			return m_value;
+		}
+		return emplace();
+	}
+
+	/// @brief Construct the value eagerly.
+	/// @details The arguments are ignored if the value has already been constructed.
+	/// @tparam Args The types of the constructor arguments.
+	/// @param args The arguments for the constructor.
+	/// @return The value.
+	template <typename... Args>
+	T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+		call_once(m_once, [this, &args...]() noexcept(std::is_nothrow_constructible_v<T, Args...>) {
+			std::construct_at(&m_value, std::forward<Args>(args)...);
+		});
+		return m_value;
+	}
+
+	/// @brief Check if the value has been constructed.
+	/// @return `true` if the value has been constructed.
+	[[nodiscard]] bool has_value() const noexcept {
+		return m_once.is_done();
+	}
+
+private:
+	once_flag m_once;  ///< @brief Guards the construction of the value.
+	union {
+		std::byte m_empty;  ///< @brief Active member before the value is constructed.
+		T m_value;          ///< @brief The value.
+	};
+};
+
+}  // namespace m3c
@@ -0,0 +1,114 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/source_location.h>
+
+#include <windows.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#ifndef M3C_TRACK_RESOURCES
+/// @brief Set to `1` to track the owners of handles and COM memory for finding leaks.
+/// @details Defined as a macro to allow redefinition in build settings. If the value is `0`, all tracking calls compile
+/// to nothing. The value MUST be the same for the library and all code using it.
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage): Use macro to allow override in build settings.
+#define M3C_TRACK_RESOURCES 0
+#endif
+
+namespace m3c {
+
+/// @brief A resource recorded by `leak_tracker`.
+struct tracked_resource final {
+	const void* key;                ///< @brief The native handle or pointer.
+	std::source_location location;  ///< @brief The location where the owner acquired the resource.
+	DWORD threadId;                 ///< @brief The thread which acquired the resource.
+};
+
+/// @brief Records the location where `BaseHandle` and `com_heap_ptr` instances acquire ownership of a resource.
+/// @details Resources are stored in a sharded hash table using open addressing, so that threads rarely contend for the
+/// same lock. If sampling is enabled, only one in N resources is tracked. Whether a resource is sampled is derived
+/// from its key, so releasing a resource which is not sampled does not touch the table.
+/// @note Ownership acquired by assigning to the address returned by `operator&` is not tracked.
+class leak_tracker final {
+public:
+	/// @brief `true` if tracking is compiled in.
+	static constexpr bool kEnabled = M3C_TRACK_RESOURCES != 0;
+
+public:
+	leak_tracker() = delete;
+
+public:
+	/// @brief Record that a resource has been acquired.
+	/// @param key The native handle or pointer.
+	/// @param location The location where the resource was acquired.
+	static constexpr void track(_In_opt_ const void* const key, const std::source_location& location) noexcept {
+		if constexpr (kEnabled) {
+			if (!std::is_constant_evaluated() && key) {
+				Track(key, location);
+			}
+		}
+	}
+
+	/// @brief Record that a resource has been released.
+	/// @param key The native handle or pointer.
+	static constexpr void untrack(_In_opt_ const void* const key) noexcept {
+		if constexpr (kEnabled) {
+			if (!std::is_constant_evaluated() && key) {
+				Untrack(key);
+			}
+		}
+	}
+
+	/// @brief Track only one in @p rate resources.
+	/// @details The rate SHOULD be set before any resource is acquired. Resources which have been tracked using a
+	/// different rate might be reported as leaks.
+	/// @param rate The sampling rate, `1` to track all resources. The value is rounded up to the next power of two and
+	/// limited to 2^28.
+	static void set_sample_rate(std::uint32_t rate) noexcept;
+
+	/// @brief Get the number of tracked resources.
+	/// @return The number of resources which have been acquired and not yet released.
+	[[nodiscard]] static std::size_t size() noexcept;
+
+	/// @brief Call a function for all tracked resources.
+	/// @details The table is locked shard by shard, i.e. the result is not an atomic snapshot.
+	/// @param callback The function to call.
+	static void for_each(const std::function<void(const tracked_resource&)>& callback);
+
+	/// @brief Log all tracked resources.
+	static void dump() noexcept;
+
+	/// @brief Log all tracked resources when the process exits.
+	static void dump_at_exit() noexcept;
+
+private:
+	/// @brief Add a resource to the table.
+	/// @param key The native handle or pointer.
+	/// @param location The location where the resource was acquired.
+	static void Track(_In_ const void* key, const std::source_location& location) noexcept;
+
+	/// @brief Remove a resource from the table.
+	/// @param key The native handle or pointer.
+	static void Untrack(_In_ const void* key) noexcept;
+};
+
+}  // namespace m3c
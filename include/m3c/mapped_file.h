@@ -0,0 +1,200 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <m3c/Handle.h>
+
+#include <windows.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace m3c {
+
+/// @brief A RAII type for a view of a `mapped_file`.
+/// @details The view unmaps the memory when it is destroyed. A view MAY outlive the `mapped_file` it was created from.
+class mapped_view final {
+public:
+	/// @brief Creates an empty view.
+	[[nodiscard]] constexpr mapped_view() noexcept = default;
+
+	mapped_view(const mapped_view&) = delete;
+
+	/// @brief Transfers ownership.
+	/// @param view Another `mapped_view`.
+	[[nodiscard]] mapped_view(mapped_view&& view) noexcept;
+
+	/// @brief Calls `UnmapViewOfFile`.
+	~mapped_view() noexcept;
+
+public:
+	mapped_view& operator=(const mapped_view&) = delete;
+
+	/// @brief Transfers ownership.
+	/// @param view Another `mapped_view`.
+	/// @return This instance.
+	mapped_view& operator=(mapped_view&& view) noexcept;
+
+	/// @brief Check if the view maps any memory.
+	/// @return `true` if the view is not empty.
+	[[nodiscard]] explicit operator bool() const noexcept {
+		return m_pData != nullptr;
+	}
+
+public:
+	/// @brief Get the start of the mapped data.
+	/// @return A pointer to the data at `offset()` or `nullptr` for an empty view.
+	[[nodiscard]] const std::byte* data() const noexcept {
+		return m_pData;
+	}
+
+	/// @brief Get the size of the mapped data.
+	/// @return The size of the view in bytes.
+	[[nodiscard]] std::size_t size() const noexcept {
+		return m_size;
+	}
+
+	/// @brief Get the position of the view in the file.
+	/// @return The offset of `data()` in the file.
+	[[nodiscard]] std::uint64_t offset() const noexcept {
+		return m_offset;
+	}
+
+	/// @brief Get the mapped data.
+	/// @return The data of the view.
+	[[nodiscard]] std::span<const std::byte> bytes() const noexcept {
+		return {m_pData, m_size};
+	}
+
+	/// @brief Check if the view can be modified.
+	/// @return `true` if the view has been created from a `mapped_file` opened for writing.
+	[[nodiscard]] bool writable() const noexcept {
+		return m_writable;
+	}
+
+	/// @brief Get the mapped data for modification.
+	/// @details An empty view returns an empty span.
+	/// @return The data of the view.
+	/// @throws std::logic_error if the view has been mapped read-only.
+	[[nodiscard]] std::span<std::byte> writable_bytes();
+
+	/// @brief Hint the system to read the data of the view into memory using large I/O requests.
+	/// @details The call returns immediately. Errors are logged because the call is a hint only.
+	void prefetch() const noexcept;
+
+	/// @brief Write modified data of the view to the file.
+	void flush() const;
+
+	/// @brief Unmap the view.
+	void close();
+
+private:
+	/// @brief Creates a new view.
+	/// @param pBase The address returned by `MapViewOfFile`.
+	/// @param delta The distance of the requested offset from @p pBase.
+	/// @param size The size of the data.
+	/// @param offset The requested offset in the file.
+	/// @param writable `true` if the view has been mapped for writing.
+	[[nodiscard]] mapped_view(_In_ void* pBase, std::size_t delta, std::size_t size, std::uint64_t offset, bool writable) noexcept;
+
+	/// @brief Unmap the view, logging any errors.
+	void CloseSilently() noexcept;
+
+private:
+	void* m_pBase = nullptr;      ///< @brief The address returned by `MapViewOfFile`, aligned to the allocation granularity.
+	std::byte* m_pData = nullptr;  ///< @brief The start of the data at `m_offset`.
+	std::size_t m_size = 0;        ///< @brief The size of the data.
+	std::uint64_t m_offset = 0;    ///< @brief The offset of the data in the file.
+	bool m_writable = false;       ///< @brief `true` if the view has been mapped for writing.
+
+	friend class mapped_file;
+};
+
+/// @brief A file which is mapped into memory for zero-copy access.
+/// @details The file is mapped using views which cover either the whole file or a window of it. Views are aligned to
+/// the allocation granularity internally, so any offset can be used. For files larger than the address space budget of
+/// the application, use `remap` to move a window over the file.
+class mapped_file final {
+public:
+	/// @brief The access mode for the file.
+	enum class mode : UCHAR {
+		kReadOnly,   ///< Views are read-only.
+		kReadWrite,  ///< Views are writable and changes are written to the file.
+	};
+
+public:
+	/// @brief Open a file and create the mapping.
+	/// @param path The path of the file.
+	/// @param fileMode The access mode.
+	[[nodiscard]] explicit mapped_file(_In_z_ const wchar_t* path, mode fileMode = mode::kReadOnly);
+
+	/// @brief Create the mapping for an open file.
+	/// @param file A file opened with at least `GENERIC_READ` and, for `mode::kReadWrite`, `GENERIC_WRITE` access.
+	/// @param fileMode The access mode.
+	[[nodiscard]] explicit mapped_file(Handle&& file, mode fileMode = mode::kReadOnly);
+
+	mapped_file(const mapped_file&) = delete;
+	[[nodiscard]] mapped_file(mapped_file&&) noexcept = default;
+	~mapped_file() noexcept = default;
+
+public:
+	mapped_file& operator=(const mapped_file&) = delete;
+	mapped_file& operator=(mapped_file&&) noexcept = default;
+
+public:
+	/// @brief Get the size of the file.
+	/// @return The size of the file when the mapping was created.
+	[[nodiscard]] std::uint64_t size() const noexcept {
+		return m_size;
+	}
+
+	/// @brief Get the access mode.
+	/// @return The access mode of the file.
+	[[nodiscard]] mode access() const noexcept {
+		return m_mode;
+	}
+
+	/// @brief Map a part of the file into memory.
+	/// @details The size is reduced if the range exceeds the end of the file. An empty view is returned if @p offset
+	/// is at or after the end of the file.
+	/// @param offset The offset in the file.
+	/// @param size The maximum size of the view, default is the remainder of the file.
+	/// @return The view.
+	[[nodiscard]] mapped_view map(std::uint64_t offset = 0, std::size_t size = SIZE_MAX) const;
+
+	/// @brief Move a view to a different part of the file.
+	/// @details The existing view is unmapped before the new one is mapped, so that the address space in use never
+	/// exceeds a single window.
+	/// @param view The view to replace.
+	/// @param offset The offset in the file.
+	/// @param size The maximum size of the view.
+	void remap(mapped_view& view, std::uint64_t offset, std::size_t size) const;
+
+private:
+	/// @brief Create the file mapping for `m_file`.
+	void CreateMapping();
+
+private:
+	Handle m_file;         ///< @brief The file.
+	Handle m_mapping;      ///< @brief The file mapping object, invalid for empty files.
+	std::uint64_t m_size;  ///< @brief The size of the file.
+	mode m_mode;           ///< @brief The access mode.
+};
+
+}  // namespace m3c
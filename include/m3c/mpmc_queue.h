@@ -0,0 +1,210 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <sal.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace m3c {
+
+/// @brief A bounded lock-free queue for multiple producers and multiple consumers.
+/// @details The queue is a ring buffer where each slot carries a sequence number (the algorithm by Dmitry Vyukov).
+/// Producers and consumers only contend on the respective position counter, both of which reside in their own cache line.
+/// @tparam T The type of the elements. Moving and destroying elements MUST NOT throw exceptions.
+template <typename T>
+requires std::is_nothrow_move_constructible_v<T> && std::is_nothrow_destructible_v<T>
+class mpmc_queue final {
+public:
+	/// @brief Creates a new queue.
+	/// @param capacity The capacity of the queue. The value is rounded up to the next power of two.
+	[[nodiscard]] explicit mpmc_queue(const std::size_t capacity)
+	    : m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+	    , m_slots(std::make_unique<Slot[]>(m_mask + 1)) {  // NOLINT(cppcoreguidelines-avoid-c-arrays): Array of slots.
+		for (std::size_t i = 0; i <= m_mask; ++i) {
+			m_slots[i].sequence.store(i, std::memory_order_relaxed);
+		}
+	}
+
+	mpmc_queue(const mpmc_queue&) = delete;
+	mpmc_queue(mpmc_queue&&) = delete;
+
+	/// @brief Destroys all elements which are still in the queue.
+	/// @details The destructor MUST NOT run concurrently with any other function.
+	~mpmc_queue() noexcept {
+		const std::size_t end = m_enqueuePos.load(std::memory_order_relaxed);
+		for (std::size_t pos = m_dequeuePos.load(std::memory_order_relaxed); pos != end; ++pos) {
+			std::destroy_at(m_slots[pos & m_mask].get());
+		}
+	}
+
+public:
+	mpmc_queue& operator=(const mpmc_queue&) = delete;
+	mpmc_queue& operator=(mpmc_queue&&) = delete;
+
+public:
+	/// @brief Get the maximum number of elements in the queue.
+	/// @return The capacity of the queue.
+	[[nodiscard]] std::size_t capacity() const noexcept {
+		return m_mask + 1;
+	}
+
+	/// @brief Get the (approximate) number of elements in the queue.
+	/// @details The value is exact only if no other thread modifies the queue at the same time.
+	/// @return The number of elements in the queue.
+	[[nodiscard]] std::size_t size() const noexcept {
+		const std::size_t dequeuePos = m_dequeuePos.load(std::memory_order_relaxed);
+		const std::size_t enqueuePos = m_enqueuePos.load(std::memory_order_relaxed);
+		return enqueuePos > dequeuePos ? std::min(enqueuePos - dequeuePos, capacity()) : 0;
+	}
+
+	/// @brief Check if the queue is (approximately) empty.
+	/// @details The value is exact only if no other thread modifies the queue at the same time.
+	/// @return `true` if the queue is empty.
+	[[nodiscard]] bool empty() const noexcept {
+		return size() == 0;
+	}
+
+	/// @brief Construct an element at the end of the queue if it is not full.
+	/// @tparam Args The types of the constructor arguments.
+	/// @param args The arguments for the constructor of the element.
+	/// @return `true` if the element was added, `false` if the queue is full.
+	template <typename... Args>
+	requires std::is_nothrow_constructible_v<T, Args...>
+	[[nodiscard]] bool try_emplace(Args&&... args) noexcept {
+		std::size_t pos;  // NOLINT(cppcoreguidelines-init-variables): Set by AcquireForEnqueue.
+		Slot* const pSlot = AcquireForEnqueue(pos);
+		if (!pSlot) {
+			[[unlikely]];
+			return false;
+		}
+		std::construct_at(pSlot->get(), std::forward<Args>(args)...);
+		pSlot->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// @brief Add an element at the end of the queue if it is not full.
+	/// @param value The value to add.
+	/// @return `true` if the element was added, `false` if the queue is full.
+	[[nodiscard]] bool try_push(T&& value) noexcept {
+		return try_emplace(std::move(value));
+	}
+
+	/// @brief Add a copy of an element at the end of the queue if it is not full.
+	/// @details If copying @p value throws an exception, the queue is not modified.
+	/// @param value The value to add.
+	/// @return `true` if the element was added, `false` if the queue is full.
+	[[nodiscard]] bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) {
+		if constexpr (std::is_nothrow_copy_constructible_v<T>) {
+			return try_emplace(value);
+		} else {
+			return try_emplace(T(value));
+		}
+	}
+
+	/// @brief Remove the element at the front of the queue.
+	/// @return The element or `std::nullopt` if the queue is empty.
+	[[nodiscard]] std::optional<T> try_pop() noexcept {
+		std::size_t pos;  // NOLINT(cppcoreguidelines-init-variables): Set by AcquireForDequeue.
+		Slot* const pSlot = AcquireForDequeue(pos);
+		if (!pSlot) {
+			return std::nullopt;
+		}
+		T* const pValue = pSlot->get();
+		std::optional<T> result(std::move(*pValue));
+		std::destroy_at(pValue);
+		pSlot->sequence.store(pos + m_mask + 1, std::memory_order_release);
+		return result;
+	}
+
+private:
+	/// @brief A slot in the ring buffer.
+	struct Slot final {
+		/// @brief Get the element stored in the slot.
+		/// @return A pointer to the storage of the element.
+		[[nodiscard]] T* get() noexcept {
+			return std::launder(reinterpret_cast<T*>(storage));
+		}
+
+		std::atomic<std::size_t> sequence;        ///< @brief The sequence number for synchronizing producers and consumers.
+		alignas(T) std::byte storage[sizeof(T)];  // NOLINT(cppcoreguidelines-avoid-c-arrays): Raw storage for the element.
+	};
+
+	/// @brief Reserve a slot for adding an element.
+	/// @param pos Receives the position of the reserved slot.
+	/// @return The reserved slot or `nullptr` if the queue is full.
+	[[nodiscard]] Slot* AcquireForEnqueue(_Out_ std::size_t& pos) noexcept {
+		pos = m_enqueuePos.load(std::memory_order_relaxed);
+		while (true) {
+			Slot& slot = m_slots[pos & m_mask];
+			const std::intptr_t diff = static_cast<std::intptr_t>(slot.sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(pos);
+			if (diff == 0) {
+				if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					[[likely]];
+					return &slot;
+				}
+			} else if (diff < 0) {
+				return nullptr;
+			} else {
+				pos = m_enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Reserve a slot for removing an element.
+	/// @param pos Receives the position of the reserved slot.
+	/// @return The reserved slot or `nullptr` if the queue is empty.
+	[[nodiscard]] Slot* AcquireForDequeue(_Out_ std::size_t& pos) noexcept {
+		pos = m_dequeuePos.load(std::memory_order_relaxed);
+		while (true) {
+			Slot& slot = m_slots[pos & m_mask];
+			const std::intptr_t diff = static_cast<std::intptr_t>(slot.sequence.load(std::memory_order_acquire)) - static_cast<std::intptr_t>(pos + 1);
+			if (diff == 0) {
+				if (m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+					[[likely]];
+					return &slot;
+				}
+			} else if (diff < 0) {
+				return nullptr;
+			} else {
+				pos = m_dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+private:
+	const std::size_t m_mask;              ///< @brief The capacity minus 1 for calculating the slot index.
+	const std::unique_ptr<Slot[]> m_slots;  // NOLINT(cppcoreguidelines-avoid-c-arrays): The ring buffer.
+
+	/// @brief The position for the next element to add.
+	alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_enqueuePos = 0;
+
+	/// @brief The position of the next element to remove.
+	alignas(std::hardware_destructive_interference_size) std::atomic<std::size_t> m_dequeuePos = 0;
+};
+
+}  // namespace m3c
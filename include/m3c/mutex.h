@@ -20,6 +20,7 @@ limitations under the License.
 #include <windows.h>
 
 #include <chrono>
+#include <utility>
 
 namespace m3c {
 
@@ -102,6 +103,67 @@ private:
 	friend class condition_variable;
 };
 
+namespace internal {
+struct QueueNode;
+}  // namespace internal
+
+/// @brief A fair lock for highly contended critical sections using the queue-based algorithm by Mellor-Crummey and Scott (MCS).
+/// @details Waiting threads form a FIFO queue and each thread spins on a node in its own cache line. Ownership is handed
+/// over directly to the next thread in the queue. After a spin budget is exhausted, waiting threads are parked using
+/// `WaitOnAddress`. For critical sections with low contention, `mutex` is the better choice.
+/// @warning The lock is NOT recursive and MUST be released by the same thread which acquired it.
+class queue_mutex final {
+public:
+	[[nodiscard]] constexpr queue_mutex() noexcept = default;
+	queue_mutex(const queue_mutex&) = delete;
+	queue_mutex(queue_mutex&&) = delete;
+	constexpr ~queue_mutex() noexcept = default;
+
+public:
+	queue_mutex& operator=(const queue_mutex&) = delete;
+	queue_mutex& operator=(queue_mutex&&) = delete;
+
+public:
+	/// @brief Acquires an exclusive lock on the `queue_mutex` object.
+	/// @details Threads acquire the lock in the order in which they called this function. Each thread has a small pool
+	/// of queue nodes. If a thread holds more `queue_mutex` locks at the same time, additional nodes are allocated.
+	/// @throws std::bad_alloc if the thread holds more than 8 locks and allocating a queue node fails.
+	void lock();
+
+	/// @brief Tries to acquire an exclusive lock on the `queue_mutex` object without waiting.
+	/// @details If the thread holds more than 8 locks and allocating a queue node fails, the function returns `false`.
+	/// @return `true` if the lock was acquired, else `false`.
+	[[nodiscard]] bool try_lock() noexcept;
+
+	/// @brief Releases an exclusive lock on the `queue_mutex` object.
+	void unlock() noexcept;
+
+private:
+	internal::QueueNode* volatile m_pTail = nullptr;  ///< @brief The last node in the queue or `nullptr` if the lock is not held.
+	internal::QueueNode* m_pOwner = nullptr;          ///< @brief The node of the current owner, only accessed while holding the lock.
+};
+
+/// @brief Manages access to a lock on a `queue_mutex` in a way safe for RAAI.
+class queue_lock final {
+public:
+	/// @brief Acquires an exclusive lock on a `queue_mutex` object.
+	/// @throws std::bad_alloc if the thread holds more than 8 locks and allocating a queue node fails.
+	[[nodiscard]] explicit queue_lock(queue_mutex& mtx);
+
+	queue_lock(const queue_lock&) = delete;
+	queue_lock(queue_lock&&) = delete;
+
+	/// @brief Releases the lock on the `queue_mutex` object.
+	~queue_lock() noexcept;
+
+public:
+	queue_lock& operator=(const queue_lock&) = delete;
+	queue_lock& operator=(queue_lock&&) = delete;
+
+private:
+	queue_mutex& m_mutex;  ///< @brief The locked `queue_mutex` object.
+};
+
 /// @brief Manages a condition variable on a `mutex` object but uses slim reader/writer (SRW) locks for synchronization.
 class condition_variable final {
 public:
@@ -125,8 +187,33 @@ public:
 	/// @param lock The lock object.
 	void wait(shared_lock& lock);
 
+	/// @brief Wait until @p pred returns `true`.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	template <typename Predicate>
+	void wait(scoped_lock& lock, Predicate pred) {
+		while (!pred()) {
+			wait(lock);
+		}
+	}
+
+	/// @brief Wait until @p pred returns `true`.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	template <typename Predicate>
+	void wait(shared_lock& lock, Predicate pred) {
+		while (!pred()) {
+			wait(lock);
+		}
+	}
+
 	/// @brief Wait until the condition is signaled or the timeout expires.
 	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The timeout is NOT truncated to milliseconds.
 	/// @tparam R The number of units (ticks) of the duration.
 	/// @tparam P The period of the duration.
 	/// @param lock The lock object.
@@ -134,11 +221,12 @@ public:
 	/// @return `true` if the condition was signaled, `false` if the timeout expired.
 	template <typename R, typename P>
 	[[nodiscard]] bool wait_for(scoped_lock& lock, const std::chrono::duration<R, P> duration) {
-		return wait_for(lock, static_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()));
+		return wait_until(lock, GetDeadline(duration));
 	}
 
 	/// @brief Wait until the condition is signaled or the timeout expires.
-	/// @details The thread MUST hold @p lock before calling this function. The @p lock is releases while waiting.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The timeout is NOT truncated to milliseconds.
 	/// @tparam R The number of units (ticks) of the duration.
 	/// @tparam P The period of the duration.
 	/// @param lock The lock object.
@@ -146,7 +234,87 @@ public:
 	/// @return `true` if the condition was signaled, `false` if the timeout expired.
 	template <typename R, typename P>
 	[[nodiscard]] bool wait_for(shared_lock& lock, const std::chrono::duration<R, P> duration) {
-		return wait_for(lock, static_cast<DWORD>(std::chrono::duration_cast<std::chrono::milliseconds>(duration).count()));
+		return wait_until(lock, GetDeadline(duration));
+	}
+
+	/// @brief Wait until @p pred returns `true` or the timeout expires.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The deadline is calculated once, i.e. spurious wakeups do not extend the total time spent waiting.
+	/// @tparam R The number of units (ticks) of the duration.
+	/// @tparam P The period of the duration.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param duration The maximum timeout for waiting.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	/// @return The result of the last evaluation of @p pred.
+	template <typename R, typename P, typename Predicate>
+	[[nodiscard]] bool wait_for(scoped_lock& lock, const std::chrono::duration<R, P> duration, Predicate pred) {
+		return wait_until(lock, GetDeadline(duration), std::move(pred));
+	}
+
+	/// @brief Wait until @p pred returns `true` or the timeout expires.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The deadline is calculated once, i.e. spurious wakeups do not extend the total time spent waiting.
+	/// @tparam R The number of units (ticks) of the duration.
+	/// @tparam P The period of the duration.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param duration The maximum timeout for waiting.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	/// @return The result of the last evaluation of @p pred.
+	template <typename R, typename P, typename Predicate>
+	[[nodiscard]] bool wait_for(shared_lock& lock, const std::chrono::duration<R, P> duration, Predicate pred) {
+		return wait_until(lock, GetDeadline(duration), std::move(pred));
+	}
+
+	/// @brief Wait until the condition is signaled or the deadline is reached.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The last fraction of a millisecond is waited for using a high-resolution waitable timer.
+	/// @param lock The lock object.
+	/// @param deadline The point in time when to stop waiting.
+	/// @return `true` if the condition was signaled, `false` if the deadline was reached.
+	[[nodiscard]] bool wait_until(scoped_lock& lock, std::chrono::steady_clock::time_point deadline);
+
+	/// @brief Wait until the condition is signaled or the deadline is reached.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// The last fraction of a millisecond is waited for using a high-resolution waitable timer.
+	/// @param lock The lock object.
+	/// @param deadline The point in time when to stop waiting.
+	/// @return `true` if the condition was signaled, `false` if the deadline was reached.
+	[[nodiscard]] bool wait_until(shared_lock& lock, std::chrono::steady_clock::time_point deadline);
+
+	/// @brief Wait until @p pred returns `true` or the deadline is reached.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param deadline The point in time when to stop waiting.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	/// @return The result of the last evaluation of @p pred.
+	template <typename Predicate>
+	[[nodiscard]] bool wait_until(scoped_lock& lock, const std::chrono::steady_clock::time_point deadline, Predicate pred) {
+		while (!pred()) {
+			if (!wait_until(lock, deadline)) {
+				return pred();
+			}
+		}
+		return true;
+	}
+
+	/// @brief Wait until @p pred returns `true` or the deadline is reached.
+	/// @details The thread MUST hold @p lock before calling this function. The @p lock is released while waiting.
+	/// @tparam Predicate The type of the predicate.
+	/// @param lock The lock object.
+	/// @param deadline The point in time when to stop waiting.
+	/// @param pred A predicate which is evaluated while @p lock is held.
+	/// @return The result of the last evaluation of @p pred.
+	template <typename Predicate>
+	[[nodiscard]] bool wait_until(shared_lock& lock, const std::chrono::steady_clock::time_point deadline, Predicate pred) {
+		while (!pred()) {
+			if (!wait_until(lock, deadline)) {
+				return pred();
+			}
+		}
+		return true;
 	}
 
 	/// @brief Notify one thread waiting for the condition to be signaled.
@@ -156,19 +324,24 @@ public:
 	void notify_all() noexcept;
 
 private:
-	/// @brief Wait until the condition is signaled or the timeout expires.
-	/// @details The thread MUST hold @p lock before calling this function. The @p lock is releases while waiting.
-	/// @param lock The lock object.
-	/// @param milliseconds The maximum timeout for waiting.
-	/// @return `true` if the condition was signaled, `false` if the timeout expired.
-	[[nodiscard]] bool wait_for(scoped_lock& lock, DWORD milliseconds);
-
-	/// @brief Wait until the condition is signaled or the timeout expires.
-	/// @details The thread MUST hold @p lock before calling this function. The @p lock is releases while waiting.
-	/// @param lock The lock object.
-	/// @param milliseconds The maximum timeout for waiting.
-	/// @return `true` if the condition was signaled, `false` if the timeout expired.
-	[[nodiscard]] bool wait_for(shared_lock& lock, DWORD milliseconds);
+	/// @brief Get the deadline for a timeout starting now.
+	/// @details Durations which exceed the range of `std::chrono::steady_clock` are saturated, fractions of ticks are rounded up.
+	/// @tparam R The number of units (ticks) of the duration.
+	/// @tparam P The period of the duration.
+	/// @param duration The timeout.
+	/// @return The point in time when the timeout expires.
+	template <typename R, typename P>
+	[[nodiscard]] static std::chrono::steady_clock::time_point GetDeadline(const std::chrono::duration<R, P> duration) noexcept {
+		const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (duration <= std::chrono::duration<R, P>::zero()) {
+			return now;
+		}
+		using Seconds = std::chrono::duration<long double>;
+		if (std::chrono::duration_cast<Seconds>(duration) >= std::chrono::duration_cast<Seconds>(std::chrono::steady_clock::time_point::max() - now)) {
+			return std::chrono::steady_clock::time_point::max();
+		}
+		return now + std::chrono::ceil<std::chrono::steady_clock::duration>(duration);
+	}
 
 private:
 	/// @brief The internal condition variable for use with SRW locks.
@@ -8,8 +8,12 @@ SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 /// @file
 /// @details "Polyfill" for clang which does not support std::source_location as of clang 14.0.0 [09287214]
 /// @copyright Adapted from https://github.com/microsoft/STL/blob/main/stl/inc/source_location, Copyright (c) Microsoft Corporation.
+/// Also provides `m3c::source_location` which trims the file name relative to the source root.
 #pragma once
 
+#include <sal.h>
+
+#include <cstddef>
 #include <source_location>  // IWYU pragma: export
 
 #ifdef __cpp_lib_source_location
@@ -69,3 +73,74 @@ private:
 }  // namespace std
 
 #endif
+
+
+/// @brief The root directory of the source files, e.g. the value of `PROJECT_SOURCE_DIR` in CMake plus a trailing slash.
+/// @details File names of `m3c::source_location` are relative to this directory. Set to an empty string to disable
+/// trimming.
+#ifndef M3C_SOURCE_ROOT
+#define M3C_SOURCE_ROOT ""
+#endif
+
+namespace m3c {
+
+namespace internal {
+
+/// @brief Get the length of the root directory at the start of a file name.
+/// @details Both forward and backward slashes are accepted as path separators and case is ignored for ASCII letters.
+/// @param fileName The file name.
+/// @param root The root directory including a trailing path separator.
+/// @return The length of @p root if @p fileName starts with @p root, else 0.
+consteval std::size_t GetSourceRootLength(_In_z_ const char* const fileName, _In_z_ const char* const root) noexcept {
+	const auto normalize = [](const char ch) constexpr noexcept {
+		return ch == '\\' ? '/' : ch >= 'A' && ch <= 'Z' ? static_cast<char>(ch - 'A' + 'a') : ch;
+	};
+	std::size_t length = 0;
+	for (; root[length]; ++length) {
+		// comparison fails at the terminating null character of fileName
+		if (normalize(fileName[length]) != normalize(root[length])) {
+			return 0;
+		}
+	}
+	return length;
+}
+
+}  // namespace internal
+
+/// @brief Same as `std::source_location` but `file_name()` returns the path relative to `M3C_SOURCE_ROOT`.
+/// @details The file name is trimmed at compile time and points into the string literal of the full path. Files outside
+/// of the root directory keep their full path.
+class source_location : public std::source_location {
+public:
+	/// @brief Creates an empty instance.
+	[[nodiscard]] constexpr source_location() noexcept = default;
+
+public:
+	/// @brief Get the source location of the caller.
+	/// @param location The source location, MUST NOT be set explicitly.
+	/// @return The source location.
+	[[nodiscard]] static consteval source_location current(const std::source_location location = std::source_location::current()) noexcept {
+		return source_location(location, internal::GetSourceRootLength(location.file_name(), M3C_SOURCE_ROOT));
+	}
+
+	/// @brief Get the file name relative to the source root.
+	/// @return The file name.
+	[[nodiscard]] constexpr _Ret_z_ const char* file_name() const noexcept {
+		return m_fileName;
+	}
+
+private:
+	/// @brief Creates a new instance.
+	/// @param location The source location.
+	/// @param offset The length of the root directory at the start of the file name.
+	[[nodiscard]] constexpr source_location(const std::source_location& location, const std::size_t offset) noexcept
+	    : std::source_location(location)
+	    , m_fileName(location.file_name() + offset) {
+		// empty
+	}
+
+private:
+	const char* m_fileName = "";  ///< @brief The file name relative to the source root.
+};
+
+}  // namespace m3c
@@ -0,0 +1,97 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Functions for throwing the exceptions of `exception.h` without including it.
+/// @details `exception.h` requires the complete types for logging. Headers which only have to report an error MAY use
+/// these functions instead. The exception carries the source location of the caller like `exception + evt::Default`,
+/// but no additional log arguments.
+#pragma once
+
+#include <m3c/source_location.h>
+
+#include <windows.h>
+#include <evntprov.h>
+#include <rpc.h>
+
+namespace m3c {
+
+//
+// windows_error
+//
+
+/// @brief Throw a `windows_error` with the source location of the caller.
+/// @param errorCode The windows error code returned by `GetLastError`.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_windows_error(_In_range_(!=, 0) DWORD errorCode, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `windows_error` with the source location of the caller and a log event.
+/// @param errorCode The windows error code returned by `GetLastError`.
+/// @param event The log event. The event descriptor MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_windows_error(_In_range_(!=, 0) DWORD errorCode, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `windows_error` with the source location of the caller and a log message.
+/// @param errorCode The windows error code returned by `GetLastError`.
+/// @param message The log message. The string MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_windows_error(_In_range_(!=, 0) DWORD errorCode, _In_z_ const char* message, const source_location& sourceLocation = source_location::current());
+
+
+//
+// rpc_error
+//
+
+/// @brief Throw a `rpc_error` with the source location of the caller.
+/// @param status The error code returned from RPC functions.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_rpc_error(_In_range_(!=, 0) RPC_STATUS status, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `rpc_error` with the source location of the caller and a log event.
+/// @param status The error code returned from RPC functions.
+/// @param event The log event. The event descriptor MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_rpc_error(_In_range_(!=, 0) RPC_STATUS status, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `rpc_error` with the source location of the caller and a log message.
+/// @param status The error code returned from RPC functions.
+/// @param message The log message. The string MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_rpc_error(_In_range_(!=, 0) RPC_STATUS status, _In_z_ const char* message, const source_location& sourceLocation = source_location::current());
+
+
+//
+// com_error
+//
+
+/// @brief Throw a `com_error` with the source location of the caller.
+/// @param hr The `HRESULT` value.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_com_error(_In_range_(<, 0) HRESULT hr, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `com_error` with the source location of the caller and a log event.
+/// @param hr The `HRESULT` value.
+/// @param event The log event. The event descriptor MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_com_error(_In_range_(<, 0) HRESULT hr, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation = source_location::current());
+
+/// @brief Throw a `com_error` with the source location of the caller and a log message.
+/// @param hr The `HRESULT` value.
+/// @param message The log message. The string MUST NOT go out of scope when the exception is thrown.
+/// @param sourceLocation The source location.
+[[noreturn]] void throw_com_error(_In_range_(<, 0) HRESULT hr, _In_z_ const char* message, const source_location& sourceLocation = source_location::current());
+
+}  // namespace m3c
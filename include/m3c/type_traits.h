@@ -23,6 +23,7 @@ limitations under the License.
 #include <memory>
 #include <span>
 #include <type_traits>
+#include <utility>
 
 #define M3C_SELECT_STRING(...) __VA_ARGS__, L##__VA_ARGS__
 
@@ -49,14 +50,14 @@ extern template _Ret_z_ const wchar_t* SelectString(_In_z_ const char* const sz,
 
 
 // forward declaration of class
-template <typename T>
+template <typename T, typename Deleter>
 class unique_ptr;
 
 /// @brief A helper to check if a type matches any one out of a given set.
 /// @tparam T The type to check.
 /// @tparam A The possible alternatives.
 template <typename T, typename... A>
-struct is_any_of : std::disjunction<std::is_same<T, A>...> {
+struct is_any_of : std::bool_constant<(std::is_same_v<T, A> || ...)> {
 	// empty
 };
 
@@ -72,6 +73,140 @@ inline constexpr bool is_any_of_v = is_any_of<T, A...>::value;
 template <typename T, typename... A>
 concept AnyOf = is_any_of_v<T, A...>;
 
+/// @brief Opt-in for types which can be moved to a different address by copying their bytes.
+/// @details The trait is modeled after P1144. Moving and then destroying the source object MUST be equivalent to
+/// `std::memcpy` for a specialization to be correct, i.e. the type MUST NOT store pointers to itself. Specialize the
+/// trait with `std::true_type` as the base class for custom types added to `LogData`.
+/// @tparam T The type to check.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {
+	// empty
+};
+
+/// @brief Constant to shorten expressions using `is_trivially_relocatable`.
+/// @tparam T The type to check.
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+
+/// @brief A list of types for compile-time lookup.
+/// @details The type is never instantiated, i.e. it is cheaper to use than `std::tuple`.
+/// @tparam T The types.
+template <typename... T>
+struct type_list final {
+	static constexpr std::size_t size = sizeof...(T);  ///< @brief The number of types.
+
+	type_list() = delete;
+};
+
+namespace internal {
+
+/// @brief Get the position of a type in a parameter pack.
+/// @details The function uses a single array instead of recursive template instantiations.
+/// @tparam T The type to find.
+/// @tparam A The types to search.
+/// @return The index of the first occurrence of @p T in @p A or `sizeof...(A)` if @p T is not found.
+template <typename T, typename... A>
+consteval std::size_t IndexOf() noexcept {
+	constexpr bool kMatches[] = {std::is_same_v<T, A>..., true};  // NOLINT(cppcoreguidelines-avoid-c-arrays): Last element stops the search.
+	std::size_t index = 0;
+	while (!kMatches[index]) {
+		++index;
+	}
+	return index;
+}
+
+/// @brief Associates a type with its position in a type list.
+/// @tparam kIndex The position.
+/// @tparam T The type.
+template <std::size_t kIndex, typename T>
+struct IndexedType {
+	using type = T;  ///< @brief The type.
+};
+
+/// @brief Derives from one `IndexedType` per type, so that a type can be looked up by overload resolution.
+/// @tparam Indexes A `std::index_sequence` for the types.
+/// @tparam T The types.
+template <typename Indexes, typename... T>
+struct IndexedTypes;
+
+/// @brief Derives from one `IndexedType` per type, so that a type can be looked up by overload resolution.
+/// @tparam kIndex The positions.
+/// @tparam T The types.
+template <std::size_t... kIndex, typename... T>
+struct IndexedTypes<std::index_sequence<kIndex...>, T...> : IndexedType<kIndex, T>... {};
+
+/// @brief Select the base class of `IndexedTypes` for a position. @details The function is never defined.
+/// @tparam kIndex The position.
+/// @tparam T The type deduced for the position.
+/// @return The base class for the position.
+template <std::size_t kIndex, typename T>
+IndexedType<kIndex, T> SelectIndexedType(const IndexedType<kIndex, T>&);
+
+}  // namespace internal
+
+/// @brief Get the position of a type in a type list, e.g. a `type_list` or a `std::tuple`.
+/// @details The value is the number of types in the list if the type is not found.
+template <typename T, typename List>
+struct index_of;
+
+/// @brief Get the position of a type in a type list, e.g. a `type_list` or a `std::tuple`.
+/// @tparam T The type to find.
+/// @tparam List The template of the type list.
+/// @tparam A The types of the list.
+template <typename T, template <typename...> typename List, typename... A>
+struct index_of<T, List<A...>> : std::integral_constant<std::size_t, internal::IndexOf<T, A...>()> {
+	// empty
+};
+
+/// @brief Constant to shorten expressions using `index_of`.
+/// @tparam T The type to find.
+/// @tparam List The type list.
+template <typename T, typename List>
+inline constexpr std::size_t index_of_v = index_of<T, List>::value;
+
+/// @brief Check if a type is contained in a type list, e.g. a `type_list` or a `std::tuple`.
+template <typename T, typename List>
+struct contains;
+
+/// @brief Check if a type is contained in a type list, e.g. a `type_list` or a `std::tuple`.
+/// @tparam T The type to find.
+/// @tparam List The template of the type list.
+/// @tparam A The types of the list.
+template <typename T, template <typename...> typename List, typename... A>
+struct contains<T, List<A...>> : is_any_of<T, A...> {
+	// empty
+};
+
+/// @brief Constant to shorten expressions using `contains`.
+/// @tparam T The type to find.
+/// @tparam List The type list.
+template <typename T, typename List>
+inline constexpr bool contains_v = contains<T, List>::value;
+
+/// @brief Get the type at a position in a type list, e.g. a `type_list` or a `std::tuple`.
+template <std::size_t kIndex, typename List>
+struct type_at;
+
+/// @brief Get the type at a position in a type list, e.g. a `type_list` or a `std::tuple`.
+/// @details The type is looked up using overload resolution instead of recursive template instantiations.
+/// @tparam kIndex The position.
+/// @tparam List The template of the type list.
+/// @tparam A The types of the list.
+template <std::size_t kIndex, template <typename...> typename List, typename... A>
+struct type_at<kIndex, List<A...>> {
+	static_assert(kIndex < sizeof...(A), "index out of range");
+
+	/// @brief The type at the position.
+	using type = typename decltype(internal::SelectIndexedType<kIndex>(std::declval<internal::IndexedTypes<std::index_sequence_for<A...>, A...>>()))::type;
+};
+
+/// @brief Shortcut for `type_at::type`.
+/// @tparam kIndex The position.
+/// @tparam List The type list.
+template <std::size_t kIndex, typename List>
+using type_at_t = typename type_at<kIndex, List>::type;
+
 
 /// @brief Check if a type is a - possibly const or volatile - pointer to a type, i.e. `true` if  @p T is `Type*` or `const Type*`.
 /// @tparam T The type to check.
@@ -140,10 +275,11 @@ struct is_unique_ptr_to : std::false_type {};
 template <typename T>
 struct is_unique_ptr_to<std::unique_ptr<T>> : std::true_type {};
 
-/// @brief Check if a type is a `m3c::unique_ptr<T>`.
+/// @brief Check if a type is a `m3c::unique_ptr<T, D>`.
 /// @tparam T The required type of the `m3c::unique_ptr`.
-template <typename T>
-struct is_unique_ptr_to<m3c::unique_ptr<T>> : std::true_type {};
+/// @tparam D The deleter.
+template <typename T, typename D>
+struct is_unique_ptr_to<m3c::unique_ptr<T, D>> : std::true_type {};
 
 /// @brief Check if a type is a `std::unique_ptr<T, D>`.
 /// @tparam T The required type of the `std::unique_ptr`.
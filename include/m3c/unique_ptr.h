@@ -19,6 +19,7 @@ limitations under the License.
 
 #include "m3c/LogArgs.h"
 #include "m3c/LogData.h"
+#include "m3c/fwd.h"
 
 #include <fmt/format.h>
 
@@ -32,10 +33,39 @@ limitations under the License.
 
 namespace m3c {
 
+/// @brief Same as `std::default_delete` but usable in constant expressions.
+/// @tparam T The type of the object.
+template <typename T>
+struct default_delete final {
+	/// @brief Delete an object.
+	/// @param p A pointer to the object.
+	constexpr void operator()(_In_opt_ T* const p) const noexcept {
+		static_assert(sizeof(T) > 0, "cannot delete incomplete type");
+		delete p;
+	}
+};
+
+/// @brief Same as `std::default_delete` but usable in constant expressions.
+/// @tparam T The type of the array elements.
+template <typename T>
+struct default_delete<T[]> final {
+	/// @brief Delete an array.
+	/// @param p A pointer to the array.
+	constexpr void operator()(_In_opt_ T* const p) const noexcept {
+		static_assert(sizeof(T) > 0, "cannot delete incomplete type");
+		delete[] p;
+	}
+};
+
 /// @brief Similar to `std::unique_ptr` but allows setting pointer value by out parameter.
+/// @details The deleter MUST be stateless. It is not stored in the object, so that a `unique_ptr` always has the size
+/// of a single pointer.
 /// @tparam T The native type of the pointer target.
-template <typename T>
+/// @tparam Deleter A stateless type which is called to destroy the object, defaults to `default_delete<T>` (see `fwd.h`).
+template <typename T, typename Deleter>
 class unique_ptr final {
+	static_assert(std::is_empty_v<Deleter> && std::is_nothrow_default_constructible_v<Deleter>, "deleter must be stateless");
+
 public:
 	/// @brief Creates an empty instance.
 	[[nodiscard]] constexpr unique_ptr() noexcept = default;
@@ -63,7 +93,7 @@ public:
 
 	/// @brief Deletes the owner object.
 	constexpr ~unique_ptr() noexcept {
-		delete m_ptr;
+		Delete(m_ptr);
 	}
 
 public:
@@ -73,7 +103,7 @@ public:
 	/// @param p Another `unique_ptr`.
 	/// @return This instance.
 	constexpr unique_ptr& operator=(unique_ptr&& p) noexcept {
-		delete m_ptr;
+		Delete(m_ptr);
 		m_ptr = p.release();
 		return *this;
 	}
@@ -81,7 +111,7 @@ public:
 	/// @brief Resets the instance to hold no value.
 	/// @return This instance.
 	constexpr unique_ptr& operator=(std::nullptr_t) noexcept {
-		delete m_ptr;
+		Delete(m_ptr);
 		m_ptr = nullptr;
 		return *this;
 	}
@@ -117,7 +147,7 @@ public:
 	/// When a value is assigned to the return value of this function, ownership is transferred to this instance.
 	/// @return The address of the pointer which is managed internally.
 	[[nodiscard]] _Ret_notnull_ T** operator&() noexcept {
-		delete m_ptr;
+		Delete(m_ptr);
 		m_ptr = nullptr;
 		return std::addressof(m_ptr);
 	}
@@ -159,7 +189,7 @@ public:
 	/// @param p A pointer.
 	constexpr void reset(_In_opt_ T* const p = nullptr) noexcept {
 		if (m_ptr != p) {
-			delete m_ptr;
+			Delete(m_ptr);
 			m_ptr = p;
 		}
 	}
@@ -185,6 +215,15 @@ public:
 		return std::hash<T*>{}(m_ptr);
 	}
 
+private:
+	/// @brief Destroy an object using the deleter.
+	/// @param p A pointer to the object or `nullptr`.
+	static constexpr void Delete(_In_opt_ T* const p) noexcept {
+		if (p) {
+			Deleter()(p);
+		}
+	}
+
 private:
 	T* m_ptr = nullptr;  ///< @brief The native pointer.
 };
@@ -196,52 +235,58 @@ private:
 
 /// @brief Allows comparison of two `unique_ptr` instances.
 /// @tparam T The type of the first managed native pointer.
+/// @tparam D The deleter of the first `unique_ptr`.
 /// @tparam U The type of the second managed native pointer.
+/// @tparam E The deleter of the second `unique_ptr`.
 /// @param ptr A `unique_ptr` object.
 /// @param oth Another `unique_ptr` object.
 /// @return `true` if @p ptr points to the same address as @p oth.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator==(const unique_ptr<T>& ptr, const unique_ptr<U>& oth) noexcept {
+template <typename T, typename D, typename U, typename E>
+[[nodiscard]] constexpr bool operator==(const unique_ptr<T, D>& ptr, const unique_ptr<U, E>& oth) noexcept {
 	return ptr.get() == oth.get();
 }
 
 /// @brief Allows comparison of `unique_ptr` with native pointers.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @tparam U The type of the native pointer.
 /// @param ptr A `unique_ptr` object.
 /// @param p A native pointer.
 /// @return `true` if @p ptr holds the same pointer as @p p.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator==(const unique_ptr<T>& ptr, const U* const p) noexcept {
+template <typename T, typename D, typename U>
+[[nodiscard]] constexpr bool operator==(const unique_ptr<T, D>& ptr, const U* const p) noexcept {
 	return ptr.get() == p;
 }
 
 /// @brief Allows comparison of `unique_ptr` with native pointers.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @tparam U The type of the native pointer.
 /// @param p A native pointer.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr holds the same pointer as @p p.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator==(const U* const p, const unique_ptr<T>& ptr) noexcept {
+template <typename T, typename D, typename U>
+[[nodiscard]] constexpr bool operator==(const U* const p, const unique_ptr<T, D>& ptr) noexcept {
 	return ptr.get() == p;
 }
 
 /// @brief Allows comparison of `unique_ptr` with `nullptr`.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr is not set.
-template <typename T>
-[[nodiscard]] constexpr bool operator==(const unique_ptr<T>& ptr, std::nullptr_t) noexcept {
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator==(const unique_ptr<T, D>& ptr, std::nullptr_t) noexcept {
 	return !ptr;
 }
 
 /// @brief Allows comparison of `unique_ptr` with `nullptr`.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr is not set.
-template <typename T>
-[[nodiscard]] constexpr bool operator==(std::nullptr_t, const unique_ptr<T>& ptr) noexcept {
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator==(std::nullptr_t, const unique_ptr<T, D>& ptr) noexcept {
 	return !ptr;
 }
 
@@ -252,60 +297,69 @@ template <typename T>
 
 /// @brief Allows comparison of two `unique_ptr` instances.
 /// @tparam T The type of the first managed native pointer.
+/// @tparam D The deleter of the first `unique_ptr`.
 /// @tparam U The type of the second managed native pointer.
+/// @tparam E The deleter of the second `unique_ptr`.
 /// @param ptr A `unique_ptr` object.
 /// @param oth Another `unique_ptr` object.
 /// @return `true` if @p ptr does not point to the same address as @p oth.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator!=(const unique_ptr<T>& ptr, const unique_ptr<U>& oth) noexcept {
+template <typename T, typename D, typename U, typename E>
+[[nodiscard]] constexpr bool operator!=(const unique_ptr<T, D>& ptr, const unique_ptr<U, E>& oth) noexcept {
 	return ptr.get() != oth.get();
 }
 
 /// @brief Allows comparison of `unique_ptr` with native pointers.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @tparam U The type of the native pointer.
 /// @param ptr A `unique_ptr` object.
 /// @param p A native pointer.
 /// @return `true` if @p ptr does not hold the same pointer as @p p.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator!=(const unique_ptr<T>& ptr, const U* const p) noexcept {
+template <typename T, typename D, typename U>
+[[nodiscard]] constexpr bool operator!=(const unique_ptr<T, D>& ptr, const U* const p) noexcept {
 	return ptr.get() != p;
 }
 
 /// @brief Allows comparison of `unique_ptr` with native pointers.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @tparam U The type of the native pointer.
 /// @param p A native pointer.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr does not hold the same pointer as @p p.
-template <typename T, typename U>
-[[nodiscard]] constexpr bool operator!=(const U* const p, const unique_ptr<T>& ptr) noexcept {
+template <typename T, typename D, typename U>
+[[nodiscard]] constexpr bool operator!=(const U* const p, const unique_ptr<T, D>& ptr) noexcept {
 	return ptr.get() != p;
 }
 
 /// @brief Allows comparison of `unique_ptr` with `nullptr`.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr is set.
-template <typename T>
-[[nodiscard]] constexpr bool operator!=(const unique_ptr<T>& ptr, std::nullptr_t) noexcept {
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator!=(const unique_ptr<T, D>& ptr, std::nullptr_t) noexcept {
 	return !!ptr;
 }
 
 /// @brief Allows comparison of `unique_ptr` with `nullptr`.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @param ptr A `unique_ptr` object.
 /// @return `true` if @p ptr is set.
-template <typename T>
-[[nodiscard]] constexpr bool operator!=(std::nullptr_t, const unique_ptr<T>& ptr) noexcept {
+template <typename T, typename D>
+[[nodiscard]] constexpr bool operator!=(std::nullptr_t, const unique_ptr<T, D>& ptr) noexcept {
 	return !!ptr;
 }
 
 
 /// @brief Specialization of the `unique_ptr` for arrays.
 /// @tparam T The type.
-template <typename T>
-class unique_ptr<T[]> final {
+/// @tparam Deleter A stateless type which is called to destroy the array.
+template <typename T, typename Deleter>
+class unique_ptr<T[], Deleter> final {
+	static_assert(std::is_empty_v<Deleter> && std::is_nothrow_default_constructible_v<Deleter>, "deleter must be stateless");
+
 public:
 	[[nodiscard]] constexpr unique_ptr() noexcept = default;
 
@@ -326,26 +380,26 @@ public:
 	}
 
 	constexpr ~unique_ptr() noexcept {
-		delete[] m_ptr;
+		Delete(m_ptr);
 	}
 
 public:
 	unique_ptr& operator=(const unique_ptr&) = delete;
 
 	constexpr unique_ptr& operator=(unique_ptr&& ptr) noexcept {
-		delete[] m_ptr;
+		Delete(m_ptr);
 		m_ptr = ptr.release();
 		return *this;
 	}
 
 	constexpr unique_ptr& operator=(std::nullptr_t) noexcept {
-		delete[] m_ptr;
+		Delete(m_ptr);
 		m_ptr = nullptr;
 		return *this;
 	}
 
 	[[nodiscard]] _Ret_notnull_ T** operator&() noexcept {
-		delete[] m_ptr;
+		Delete(m_ptr);
 		m_ptr = nullptr;
 		return std::addressof(m_ptr);
 	}
@@ -383,7 +437,7 @@ public:
 	constexpr void reset(_In_opt_ T* p = nullptr) noexcept {
 		if (m_ptr != p) {
 			[[likely]];
-			delete[] m_ptr;
+			Delete(m_ptr);
 			m_ptr = p;
 		}
 	}
@@ -406,6 +460,13 @@ public:
 		return std::hash<void*>{}(m_ptr);
 	}
 
+private:
+	static constexpr void Delete(_In_opt_ T* const p) noexcept {
+		if (p) {
+			Deleter()(p);
+		}
+	}
+
 private:
 	T* m_ptr = nullptr;
 };
@@ -434,12 +495,95 @@ requires std::is_array_v<T>
 }
 
 
+namespace internal {
+
+/// @brief The memory block created by `allocate_unique` which holds the object and a copy of the allocator.
+/// @details The storage of the object is the first member, so that the address of the object is also the address of
+/// the block.
+/// @tparam T The type of the object.
+/// @tparam Alloc The type of the allocator.
+template <typename T, typename Alloc>
+struct AllocatedBlock final {
+	/// @brief The allocator rebound for allocating blocks.
+	using allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<AllocatedBlock>;
+
+	/// @brief The allocator rebound for constructing and destroying the object.
+	using value_allocator_type = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+	/// @brief Creates a new block without constructing the object.
+	/// @param alloc The allocator which is used to release the block.
+	[[nodiscard]] explicit AllocatedBlock(const allocator_type& alloc) noexcept
+	    : allocator(alloc) {
+		// empty
+	}
+
+	alignas(T) std::byte storage[sizeof(T)];  // NOLINT(cppcoreguidelines-avoid-c-arrays): Raw storage for the object.
+	allocator_type allocator;                 ///< @brief The allocator which has allocated the block.
+};
+
+}  // namespace internal
+
+/// @brief A stateless deleter for objects created by `allocate_unique`.
+/// @details The allocator is stored in front of the object, so that the deleter does not need any state.
+/// @tparam T The type of the object.
+/// @tparam Alloc The type of the allocator.
+template <typename T, typename Alloc>
+struct allocator_delete final {
+	/// @brief Destroy the object and release the memory using the allocator which has allocated it.
+	/// @param p A pointer to an object created by `allocate_unique`.
+	void operator()(_In_ T* const p) const noexcept {
+		using Block = internal::AllocatedBlock<T, Alloc>;
+		using BlockTraits = std::allocator_traits<typename Block::allocator_type>;
+		static_assert(std::is_standard_layout_v<Block>, "block must have standard layout");
+		static_assert(std::is_same_v<typename BlockTraits::pointer, Block*>, "allocator must use native pointers");
+
+		Block* const pBlock = reinterpret_cast<Block*>(p);
+		typename Block::allocator_type allocator(std::move(pBlock->allocator));
+		typename Block::value_allocator_type valueAllocator(allocator);
+		std::allocator_traits<typename Block::value_allocator_type>::destroy(valueAllocator, p);
+		std::destroy_at(pBlock);
+		BlockTraits::deallocate(allocator, pBlock, 1);
+	}
+};
+
+/// @brief Creates a new `unique_ptr` for an object using an allocator.
+/// @details The object is constructed using `std::allocator_traits::construct`, i.e. types which use an allocator, e.g.
+/// `std::pmr::string`, receive a `std::pmr::polymorphic_allocator`. A copy of the allocator is stored together with
+/// the object. The `unique_ptr` has the size of a single pointer.
+/// @tparam T The type of the object.
+/// @tparam Alloc The type of the allocator.
+/// @tparam Args The types of the arguments for the constructor of @p T.
+/// @param alloc The allocator.
+/// @param args The arguments for the constructor of @p T.
+/// @return A `unique_ptr` holding the new object.
+template <typename T, typename Alloc, typename... Args>
+requires(!std::is_array_v<T>)
+    [[nodiscard]] unique_ptr<T, allocator_delete<T, Alloc>> allocate_unique(const Alloc& alloc, Args&&... args) {
+	using Block = internal::AllocatedBlock<T, Alloc>;
+	using BlockTraits = std::allocator_traits<typename Block::allocator_type>;
+
+	typename Block::allocator_type allocator(alloc);
+	Block* const pBlock = std::construct_at(BlockTraits::allocate(allocator, 1), allocator);
+	try {
+		T* const p = reinterpret_cast<T*>(pBlock->storage);
+		typename Block::value_allocator_type valueAllocator(alloc);
+		std::allocator_traits<typename Block::value_allocator_type>::construct(valueAllocator, p, std::forward<Args>(args)...);
+		return unique_ptr<T, allocator_delete<T, Alloc>>(p);
+	} catch (...) {
+		std::destroy_at(pBlock);
+		BlockTraits::deallocate(allocator, pBlock, 1);
+		throw;
+	}
+}
+
+
 /// @brief Swap function.
 /// @tparam T The type of the managed native pointer.
+/// @tparam D The deleter.
 /// @param ptr A `unique_ptr` object.
 /// @param oth Another `unique_ptr` object.
-template <typename T>
-constexpr void swap(unique_ptr<T>& ptr, unique_ptr<T>& oth) noexcept {
+template <typename T, typename D>
+constexpr void swap(unique_ptr<T, D>& ptr, unique_ptr<T, D>& oth) noexcept {
 	ptr.swap(oth);
 }
 
@@ -447,9 +591,9 @@ constexpr void swap(unique_ptr<T>& ptr, unique_ptr<T>& oth) noexcept {
 
 
 /// @brief Specialization of std::hash.
-template <typename T>
-struct std::hash<m3c::unique_ptr<T>> {
-	[[nodiscard]] constexpr std::size_t operator()(const m3c::unique_ptr<T>& ptr) const noexcept {
+template <typename T, typename D>
+struct std::hash<m3c::unique_ptr<T, D>> {
+	[[nodiscard]] constexpr std::size_t operator()(const m3c::unique_ptr<T, D>& ptr) const noexcept {
 		return ptr.hash();
 	}
 };
@@ -457,16 +601,17 @@ struct std::hash<m3c::unique_ptr<T>> {
 
 /// @brief Specialization of `fmt::formatter` for a `m3c::unique_ptr`.
 /// @tparam T The type managed by the `m3c::unique_ptr`.
+/// @tparam D The deleter of the `m3c::unique_ptr`.
 /// @tparam CharT The character type of the string.
-template <typename T, typename CharT>
-struct fmt::formatter<m3c::unique_ptr<T>, CharT> : public fmt::formatter<const void*, CharT> {
+template <typename T, typename D, typename CharT>
+struct fmt::formatter<m3c::unique_ptr<T, D>, CharT> : public fmt::formatter<const void*, CharT> {
 	/// @brief Format the handle.
 	/// @tparam FormatContext see `fmt::formatter::format`.
 	/// @param arg A handle.
 	/// @param ctx see `fmt::formatter::format`.
 	/// @return see `fmt::formatter::format`.
 	template <typename FormatContext>
-	[[nodiscard]] auto format(const m3c::unique_ptr<T>& arg, FormatContext& ctx) const -> decltype(ctx.out()) {
+	[[nodiscard]] auto format(const m3c::unique_ptr<T, D>& arg, FormatContext& ctx) const -> decltype(ctx.out()) {
 		return __super::format(static_cast<const void*>(arg.get()), ctx);
 	}
 };
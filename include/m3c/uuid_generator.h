@@ -0,0 +1,47 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+#pragma once
+
+#include <windows.h>
+
+namespace m3c {
+
+/// @brief Fast generation of UUIDs without a call to the RPC runtime.
+/// @details Random bits are taken from a per-thread xoshiro256** generator which is seeded from the operating system
+/// using `BCryptGenRandom` on first use in a thread. The functions are lock-free and do not allocate memory.
+/// @note The generator is NOT suitable for values which must not be predictable, e.g. secrets or session tokens. Use
+/// `UuidCreate` for these cases.
+class uuid_generator final {
+public:
+	uuid_generator() = delete;
+
+public:
+	/// @brief Create a random UUID (version 4).
+	/// @return A new UUID.
+	[[nodiscard]] static GUID v4() noexcept;
+
+	/// @brief Create a time-ordered UUID (version 7).
+	/// @details The UUID holds the milliseconds since the UNIX epoch followed by a 12 bit counter and 62 random bits.
+	/// Values created by all threads of the process are strictly increasing when compared field-by-field, i.e. in the
+	/// order of their string representation. If more than 4096 values are created within one millisecond, the
+	/// timestamp runs ahead of the system time until the rate decreases.
+	/// @return A new UUID.
+	[[nodiscard]] static GUID v7() noexcept;
+};
+
+}  // namespace m3c
@@ -19,10 +19,148 @@ limitations under the License.
 #include "m3c/Handle.h"
 
 #include "m3c/Log.h"
+#include "m3c/channel.h"
 #include "m3c/exception.h"
+#include "m3c/lazy.h"
 
 #include "m3c.events.h"
 
+#include <windows.h>
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <new>
+
+namespace m3c {
+
+namespace {
+
+/// @brief Queue and background thread for closing handles of `AsyncHandle` objects.
+/// @details The object is never destroyed because the background thread keeps running until the process exits.
+class AsyncCloseQueue final {
+public:
+	[[nodiscard]] AsyncCloseQueue()
+	    : m_handles(kQueueSize) {
+		// empty
+	}
+
+	AsyncCloseQueue(const AsyncCloseQueue&) = delete;
+	AsyncCloseQueue(AsyncCloseQueue&&) = delete;
+	~AsyncCloseQueue() noexcept = default;
+
+public:
+	AsyncCloseQueue& operator=(const AsyncCloseQueue&) = delete;
+	AsyncCloseQueue& operator=(AsyncCloseQueue&&) = delete;
+
+public:
+	/// @brief Get the single instance, starting the background thread on first use.
+	/// @return The instance or `nullptr` if the background thread could not be started.
+	[[nodiscard]] static AsyncCloseQueue* GetInstance() noexcept {
+		call_once(s_once, []() noexcept {
+			s_pInstance = Create();
+		});
+		return s_pInstance;
+	}
+
+	/// @brief Get the single instance if it has been created.
+	/// @return The instance or `nullptr`.
+	[[nodiscard]] static AsyncCloseQueue* GetInstanceIfCreated() noexcept {
+		return s_once.is_done() ? s_pInstance : nullptr;
+	}
+
+	/// @brief Queue a handle for closing.
+	/// @param hNative The handle.
+	/// @return `true` if the handle was added, `false` if the queue is full.
+	[[nodiscard]] bool TryPush(const HANDLE hNative) noexcept {
+		InterlockedIncrement(&m_pending);
+		if (m_handles.try_push(hNative)) {
+			[[likely]];
+			return true;
+		}
+		Release(1);
+		return false;
+	}
+
+	/// @brief Wait until all queued handles have been closed.
+	void Flush() noexcept {
+		for (LONG pending = ReadAcquire(&m_pending); pending; pending = ReadAcquire(&m_pending)) {
+			WaitOnAddress(&m_pending, &pending, sizeof(pending), INFINITE);
+		}
+	}
+
+private:
+	/// @brief Create the instance and start the background thread.
+	/// @return The instance or `nullptr` in case of errors.
+	[[nodiscard]] static AsyncCloseQueue* Create() noexcept {
+		AsyncCloseQueue* pQueue;  // NOLINT(cppcoreguidelines-init-variables): Initialized in try block.
+		try {
+			pQueue = new AsyncCloseQueue();
+		} catch (const std::bad_alloc&) {
+			Log::Error(evt::AsyncHandleCloser_E, win32_error(ERROR_NOT_ENOUGH_MEMORY));
+			return nullptr;
+		}
+
+		const HANDLE hThread = CreateThread(nullptr, 0, &Run, pQueue, 0, nullptr);
+		if (!hThread) {
+			[[unlikely]];
+			Log::Error(evt::AsyncHandleCloser_E, last_error());
+			delete pQueue;
+			return nullptr;
+		}
+		internal::HandleCloser::CloseSilently(hThread);
+		return pQueue;
+	}
+
+	/// @brief The main function of the background thread.
+	/// @param pContext The `AsyncCloseQueue` object.
+	/// @return Never returns.
+	static DWORD WINAPI Run(void* const pContext) noexcept {
+		AsyncCloseQueue& queue = *static_cast<AsyncCloseQueue*>(pContext);
+		std::array<HANDLE, kBatchSize> handles;  // NOLINT(cppcoreguidelines-pro-type-member-init): Filled by pop_n.
+		while (true) {
+			try {
+				const std::size_t count = queue.m_handles.pop_n(handles.begin(), handles.size());
+				for (std::size_t i = 0; i < count; ++i) {
+					internal::HandleCloser::CloseSilently(handles[i]);
+				}
+				queue.Release(count);
+			} catch (...) {
+				Log::ErrorException(evt::AsyncHandleCloser_Run);
+			}
+		}
+	}
+
+	/// @brief Mark handles as closed and wake up threads in `Flush` if no more handles are pending.
+	/// @param count The number of closed handles.
+	void Release(const std::size_t count) noexcept {
+		const LONG closed = static_cast<LONG>(count);
+		if (InterlockedExchangeAdd(&m_pending, -closed) == closed) {
+			WakeByAddressAll(const_cast<LONG*>(&m_pending));  // NOLINT(cppcoreguidelines-pro-type-const-cast): API requires non-volatile pointer.
+		}
+	}
+
+private:
+	static constexpr std::size_t kQueueSize = 1024;  ///< @brief The maximum number of queued handles.
+	static constexpr std::size_t kBatchSize = 64;    ///< @brief The maximum number of handles closed in one batch.
+
+	static constinit inline once_flag s_once;                        ///< @brief Guards the creation of the instance.
+	static constinit inline AsyncCloseQueue* s_pInstance = nullptr;  ///< @brief The single instance.
+
+	channel<HANDLE> m_handles;    ///< @brief The handles to close.
+	volatile LONG m_pending = 0;  ///< @brief The number of handles which are queued or currently being closed.
+};
+
+}  // namespace
+
+void flush_async_handles() noexcept {
+	if (AsyncCloseQueue* const pQueue = AsyncCloseQueue::GetInstanceIfCreated(); pQueue) {
+		pQueue->Flush();
+	}
+}
+
+}  // namespace m3c
+
 namespace m3c::internal {
 
 void HandleCloser::Close(HANDLE hNative) {
@@ -53,8 +191,21 @@ void FindCloser::CloseSilently(HANDLE hNative) noexcept {
 	}
 }
 
+void AsyncHandleCloser::Close(HANDLE hNative) {
+	HandleCloser::Close(hNative);
+}
+
+void AsyncHandleCloser::CloseSilently(HANDLE hNative) noexcept {
+	AsyncCloseQueue* const pQueue = AsyncCloseQueue::GetInstance();
+	if (!pQueue || !pQueue->TryPush(hNative)) {
+		[[unlikely]];
+		HandleCloser::CloseSilently(hNative);
+	}
+}
+
 template class BaseHandle<HandleCloser>;
 template class BaseHandle<FindCloser>;
+template class BaseHandle<AsyncHandleCloser>;
 
 template bool operator==(const BaseHandle<HandleCloser>& handle, const BaseHandle<HandleCloser>& oth) noexcept;
 template bool operator==(const BaseHandle<HandleCloser>& handle, const HANDLE hNative) noexcept;
@@ -64,6 +215,10 @@ template bool operator==(const BaseHandle<FindCloser>& handle, const BaseHandle<
 template bool operator==(const BaseHandle<FindCloser>& handle, const HANDLE hNative) noexcept;
 template bool operator==(const HANDLE hNative, const BaseHandle<FindCloser>& handle) noexcept;
 
+template bool operator==(const BaseHandle<AsyncHandleCloser>& handle, const BaseHandle<AsyncHandleCloser>& oth) noexcept;
+template bool operator==(const BaseHandle<AsyncHandleCloser>& handle, const HANDLE hNative) noexcept;
+template bool operator==(const HANDLE hNative, const BaseHandle<AsyncHandleCloser>& handle) noexcept;
+
 template bool operator!=(const BaseHandle<HandleCloser>& handle, const BaseHandle<HandleCloser>& oth) noexcept;
 template bool operator!=(const BaseHandle<HandleCloser>& handle, const HANDLE hNative) noexcept;
 template bool operator!=(const HANDLE hNative, const BaseHandle<HandleCloser>& handle) noexcept;
@@ -72,15 +227,23 @@ template bool operator!=(const BaseHandle<FindCloser>& handle, const BaseHandle<
 template bool operator!=(const BaseHandle<FindCloser>& handle, const HANDLE hNative) noexcept;
 template bool operator!=(const HANDLE hNative, const BaseHandle<FindCloser>& handle) noexcept;
 
+template bool operator!=(const BaseHandle<AsyncHandleCloser>& handle, const BaseHandle<AsyncHandleCloser>& oth) noexcept;
+template bool operator!=(const BaseHandle<AsyncHandleCloser>& handle, const HANDLE hNative) noexcept;
+template bool operator!=(const HANDLE hNative, const BaseHandle<AsyncHandleCloser>& handle) noexcept;
+
 template void swap(BaseHandle<HandleCloser>& handle, BaseHandle<HandleCloser>& oth) noexcept;
 template void swap(BaseHandle<FindCloser>& handle, BaseHandle<FindCloser>& oth) noexcept;
+template void swap(BaseHandle<AsyncHandleCloser>& handle, BaseHandle<AsyncHandleCloser>& oth) noexcept;
 
 }  // namespace m3c::internal
 
 template struct std::hash<m3c::internal::BaseHandle<m3c::internal::HandleCloser>>;
 template struct std::hash<m3c::internal::BaseHandle<m3c::internal::FindCloser>>;
+template struct std::hash<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>>;
 
 template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::HandleCloser>, char>;
 template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::HandleCloser>, wchar_t>;
 template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::FindCloser>, char>;
 template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::FindCloser>, wchar_t>;
+template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>, char>;
+template struct fmt::formatter<m3c::internal::BaseHandle<m3c::internal::AsyncHandleCloser>, wchar_t>;
@@ -71,7 +71,7 @@ constinit const Priority Log::kLevel = kMinimumLevel;
 Log::Log() noexcept {
 	if constexpr (kOutputEvent) {
 		assert(!IsEqualGUID(kGuid, {0}));  // log events but no provider defined
-		RegisterEvents();
+		RegisterEventsAsync();
 	}
 }
 
@@ -86,7 +86,12 @@ void Log::DoLogMessage(const Priority priority, const internal::LogContext<M>& c
 #ifdef _DEBUG
 	std::size_t assertArgCount = 0;
 #endif
-	const std::source_location& sourceLocation = context.GetSourceLocation();
+	if (priority <= Priority::kError && s_scopeDepth) {
+		[[unlikely]];
+		// write the context of the error first
+		FlushBuffer();
+	}
+	const source_location& sourceLocation = context.GetSourceLocation();
 	if constexpr (kOutputPrint) {
 		LogFormatArgs formatArgs;
 		print(formatArgs);
@@ -123,6 +128,10 @@ template void Log::DoLogMessage(Priority, const internal::LogContext<const char*
 template <internal::LogMessage M>
 void Log::DoLogException(const Priority priority, const internal::LogContext<M>& context, const internal::ClosureExcept<void, LogFormatArgs&>&& print, const internal::ClosureExcept<void, LogEventArgs&>&& event) {
 	if constexpr (kOutputPrint || (kOutputEvent && internal::LogContext<M>::kIsEventDescriptor)) {
+		if (s_scopeDepth) {
+			[[unlikely]];
+			FlushBuffer();
+		}
 		std::string cause;
 		GUID activityId;
 		bool mustResetActivityId;
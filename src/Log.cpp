@@ -22,6 +22,8 @@ limitations under the License.
 #include "m3c/LogData.h"
 #include "m3c/exception.h"
 #include "m3c/finally.h"
+#include "m3c/lazy.h"
+#include "m3c/mutex.h"
 #include "m3c/source_location.h"
 
 #include "m3c.events.h"
@@ -31,21 +33,32 @@ limitations under the License.
 #include <rpc.h>
 #include <winmeta.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cctype>
+#include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <exception>
-#include <map>
+#include <limits>
+#include <memory>
 #include <new>
 #include <regex>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 #include <system_error>
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace m3c {
 
@@ -57,11 +70,15 @@ template class LogContext<const char*>;
 template class Closure<false, void, LogFormatArgs&>;
 template class Closure<false, void, LogEventArgs&>;
 template class Closure<true, void, Priority, HRESULT>;
+template class Closure<false, void, LogData&>;
 
 }  // namespace internal
 
 namespace {
 
+/// @brief The maximum sampling rate which keeps the sample mask within the positive range of `LONG`.
+constexpr std::uint32_t kMaxSampleRate = 1u << 30;
+
 /// @brief Get the string for a message id.
 /// @tparam kDefaultBufferSize The size of the stack buffer which is used before a dynamically allocated buffer.
 /// @param messageId The message id.
@@ -96,6 +113,22 @@ template <std::size_t kDefaultBufferSize>
 }
 
 
+/// @brief Get the message id for a value from a table generated from the event manifest.
+/// @tparam K The type of the value.
+/// @param table The table sorted by value.
+/// @param value The value.
+/// @param name The name of the table for the exception.
+/// @return The message id for @p value.
+template <typename K>
+[[nodiscard]] DWORD FindMessageId(const std::span<const std::pair<K, DWORD>> table, const K value, _In_z_ const char* const name) {
+	const auto it = std::ranges::lower_bound(table, value, {}, &std::pair<K, DWORD>::first);
+	if (it == table.end() || it->first != value) {
+		[[unlikely]];
+		throw std::out_of_range(name) + evt::Default;
+	}
+	return it->second;
+}
+
 /// @brief Get the message id for a log level.
 /// @param priority The priority.
 /// @return The message id for the log level.
@@ -118,11 +151,7 @@ template <std::size_t kDefaultBufferSize>
 	case Priority::kTrace:
 		return MSG_m3c_level_Trace;
 	default:
-		try {
-			return internal::kLevelNames.at(static_cast<std::underlying_type_t<Priority>>(priority));
-		} catch (const std::out_of_range&) {
-			std::throw_with_nested(std::out_of_range("level") + evt::Default);
-		}
+		return FindMessageId(internal::kLevelNames, static_cast<std::underlying_type_t<Priority>>(priority), "level");
 	}
 }
 
@@ -130,13 +159,292 @@ template <std::size_t kDefaultBufferSize>
 /// @param eventId The event id.
 /// @return The message id for the event id.
 [[nodiscard]] DWORD GetEventMessageId(const USHORT eventId) {
-	try {
-		return internal::kEventMessages.at(eventId);
-	} catch (const std::out_of_range&) {
-		std::throw_with_nested(std::out_of_range("message") + evt::Default);
+	return FindMessageId(internal::kEventMessages, eventId, "message");
+}
+
+/// @brief Guards the queue of events which are logged while the logger registers with the Windows event log.
+constinit mutex s_pendingEventsMutex;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared by all threads.
+
+/// @brief A ring buffer for messages which are not logged because of their priority.
+/// @details The arguments are stored in their `LogData` encoding and only formatted when the buffer is written.
+/// Discarding the buffer just resets the counters, the records are overwritten when the buffer is used again.
+class LogBuffer final {
+public:
+	/// @brief A buffered message.
+	struct Record final {
+		EVENT_DESCRIPTOR event;          ///< @brief The event.
+		Priority priority;               ///< @brief The log priority.
+		source_location sourceLocation;  ///< @brief The source location of the log message.
+		LogData logData;                 ///< @brief The log arguments.
+	};
+
+public:
+	[[nodiscard]] LogBuffer() noexcept = default;
+	LogBuffer(const LogBuffer&) = delete;
+	LogBuffer(LogBuffer&&) = delete;
+	~LogBuffer() noexcept = default;
+
+public:
+	LogBuffer& operator=(const LogBuffer&) = delete;
+	LogBuffer& operator=(LogBuffer&&) = delete;
+
+public:
+	/// @brief Add a message, overwriting the oldest message if the buffer is full.
+	/// @details Messages logged while the buffer is written are dropped.
+	/// @param event The event.
+	/// @param priority The log priority.
+	/// @param sourceLocation The source location of the log message.
+	/// @param logData The log arguments.
+	void Add(const EVENT_DESCRIPTOR& event, const Priority priority, const source_location& sourceLocation, LogData&& logData) noexcept {
+		if (m_draining) {
+			[[unlikely]];
+			return;
+		}
+		Record& record = m_records[(m_start + m_size) % kCapacity];
+		record.event = event;
+		record.priority = priority;
+		record.sourceLocation = sourceLocation;
+		record.logData = std::move(logData);
+		if (m_size < kCapacity) {
+			++m_size;
+		} else {
+			m_start = (m_start + 1) % kCapacity;
+		}
 	}
+
+	/// @brief Remove all messages from the buffer.
+	/// @tparam F The type of the callable.
+	/// @param f A callable which is called for each message starting with the oldest one.
+	template <typename F>
+	void Drain(F&& f) noexcept {
+		if (m_draining || !m_size) {
+			return;
+		}
+		m_draining = true;
+		for (std::uint32_t i = 0; i < m_size; ++i) {
+			f(std::as_const(m_records[(m_start + i) % kCapacity]));
+		}
+		Clear();
+		m_draining = false;
+	}
+
+	/// @brief Discard all messages.
+	void Clear() noexcept {
+		m_start = 0;
+		m_size = 0;
+	}
+
+private:
+	static constexpr std::uint32_t kCapacity = 64;  ///< @brief The maximum number of messages in the buffer.
+
+	std::array<Record, kCapacity> m_records;  ///< @brief The messages.
+	std::uint32_t m_start = 0;                ///< @brief The index of the oldest message.
+	std::uint32_t m_size = 0;                 ///< @brief The number of messages.
+	bool m_draining = false;                  ///< @brief `true` while the buffer is written.
+};
+
+/// @brief The cached sampling decision for the activity of the current thread.
+struct SampleDecision final {
+	GUID activityId;  ///< @brief The activity id.
+	LONG mask;        ///< @brief The sample mask which was used for the decision.
+	bool sampled;     ///< @brief `true` if the messages of the activity are logged.
+};
+
+/// @brief The sampling decision of the current thread.
+constinit thread_local SampleDecision s_sampleDecision = {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+/// @brief Mix all bits of a value.
+/// @param value The value.
+/// @return The hash value.
+[[nodiscard]] constexpr std::uint64_t Mix(std::uint64_t value) noexcept {
+	// finalizer of splitmix64
+	value = (value ^ (value >> 30u)) * 0xBF58476D1CE4E5B9u;
+	value = (value ^ (value >> 27u)) * 0x94D049BB133111EBu;
+	return value ^ (value >> 31u);
+}
+
+/// @brief Mix all bits of an activity id.
+/// @param activityId The activity id.
+/// @return The hash value.
+[[nodiscard]] std::uint64_t Hash(const GUID& activityId) noexcept {
+	std::uint64_t parts[2];  // NOLINT(cppcoreguidelines-avoid-c-arrays): Raw bytes of the GUID.
+	static_assert(sizeof(parts) == sizeof(GUID));
+	std::memcpy(parts, &activityId, sizeof(parts));
+	return Mix(parts[0] ^ parts[1]);
+}
+
+/// @brief The message buffer of the current thread, created when the first message is buffered.
+constinit thread_local std::unique_ptr<LogBuffer> s_pLogBuffer;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+/// @brief Compare two characters of a file name or function name.
+/// @param lhs A character.
+/// @param rhs Another character.
+/// @return `true` if the characters are the same ignoring case and the type of path separator.
+[[nodiscard]] bool IsSameChar(const char lhs, const char rhs) noexcept {
+	if (lhs == rhs) {
+		[[likely]];
+		return true;
+	}
+	if ((lhs == '/' || lhs == '\\') && (rhs == '/' || rhs == '\\')) {
+		return true;
+	}
+	return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs));
 }
 
+/// @brief Match a string against a pattern containing the wildcards `*` and `?`.
+/// @param pattern The pattern.
+/// @param str The string.
+/// @return `true` if @p str matches @p pattern.
+[[nodiscard]] bool MatchWildcard(const std::string_view pattern, const std::string_view str) noexcept {
+	std::size_t p = 0;
+	std::size_t s = 0;
+	std::size_t star = std::string_view::npos;
+	std::size_t mark = 0;
+	while (s < str.size()) {
+		if (p < pattern.size() && (pattern[p] == '?' || IsSameChar(pattern[p], str[s]))) {
+			++p;
+			++s;
+		} else if (p < pattern.size() && pattern[p] == '*') {
+			// remember position for backtracking
+			star = p++;
+			mark = s;
+		} else if (star != std::string_view::npos) {
+			p = star + 1;
+			s = ++mark;
+		} else {
+			return false;
+		}
+	}
+	while (p < pattern.size() && pattern[p] == '*') {
+		++p;
+	}
+	return p == pattern.size();
+}
+
+/// @brief A rule for enabling log messages at call sites.
+struct SiteRule final {
+	std::string filePattern;      ///< @brief The pattern for the file name, empty for all files.
+	std::string functionPattern;  ///< @brief The pattern for the function name, empty for all functions.
+	std::uint_least32_t first;    ///< @brief The first line.
+	std::uint_least32_t last;     ///< @brief The last line (inclusive).
+	Priority priority;            ///< @brief The least important priority which is logged.
+
+	/// @brief Check if the rule applies to a call site.
+	/// @param sourceLocation The source location of the call site.
+	/// @return `true` if the rule applies.
+	[[nodiscard]] bool Matches(const source_location& sourceLocation) const noexcept {
+		return sourceLocation.line() >= first && sourceLocation.line() <= last
+		       && (filePattern.empty() || MatchWildcard(filePattern, sourceLocation.file_name()))
+		       && (functionPattern.empty() || MatchWildcard(functionPattern, sourceLocation.function_name()));
+	}
+};
+
+/// @brief A call site of a log function.
+struct Site final {
+	/// @brief Creates a new call site.
+	/// @param sourceLocation The source location of the call site.
+	/// @param priority The least important priority which is logged.
+	[[nodiscard]] Site(const source_location& sourceLocation, const Priority priority) noexcept
+	    : sourceLocation(sourceLocation)
+	    , level(priority) {
+		// empty
+	}
+
+	const source_location sourceLocation;  ///< @brief The source location.
+	std::atomic<Priority> level;           ///< @brief The least important priority which is logged, `Priority::kNone` if disabled.
+};
+
+/// @brief The key of a call site.
+/// @details The string literals of the source location are compared by address, so a call site in an inline function
+/// might be registered once per translation unit.
+struct SiteKey final {
+	const char* fileName;        ///< @brief The file name.
+	std::uint_least32_t line;    ///< @brief The line.
+	std::uint_least32_t column;  ///< @brief The column.
+
+	[[nodiscard]] constexpr bool operator==(const SiteKey&) const noexcept = default;
+};
+
+/// @brief The hash function for `SiteKey`.
+struct SiteKeyHash final {
+	/// @brief Get the hash value of a call site.
+	/// @param key The key.
+	/// @return The hash value.
+	[[nodiscard]] std::size_t operator()(const SiteKey& key) const noexcept {
+		return static_cast<std::size_t>(Mix(reinterpret_cast<std::uintptr_t>(key.fileName) ^ (static_cast<std::uint64_t>(key.line) << 32u) ^ key.column));
+	}
+};
+
+/// @brief All call sites which have been hit while rules exist and the rules for enabling them.
+/// @details Call sites are never removed, so pointers to a `Site` stay valid for the lifetime of the registry.
+class SiteRegistry final {
+public:
+	[[nodiscard]] SiteRegistry() = default;
+	SiteRegistry(const SiteRegistry&) = delete;
+	SiteRegistry(SiteRegistry&&) = delete;
+	~SiteRegistry() noexcept = default;
+
+public:
+	SiteRegistry& operator=(const SiteRegistry&) = delete;
+	SiteRegistry& operator=(SiteRegistry&&) = delete;
+
+public:
+	/// @brief Get the call site for a source location, registering the call site if required.
+	/// @param sourceLocation The source location of the call site.
+	/// @return The call site.
+	[[nodiscard]] const Site& GetSite(const source_location& sourceLocation) {
+		const SiteKey key{.fileName = sourceLocation.file_name(), .line = sourceLocation.line(), .column = sourceLocation.column()};
+		{
+			shared_lock lock(m_mutex);
+			if (const auto it = m_sites.find(key); it != m_sites.cend()) {
+				[[likely]];
+				return it->second;
+			}
+		}
+
+		scoped_lock lock(m_mutex);
+		Priority level = Priority::kNone;
+		for (const SiteRule& rule : m_rules) {
+			if (rule.Matches(sourceLocation)) {
+				level = std::max(level, rule.priority);
+			}
+		}
+		return m_sites.try_emplace(key, sourceLocation, level).first->second;
+	}
+
+	/// @brief Add a rule and apply it to all registered call sites.
+	/// @param rule The rule.
+	void AddRule(SiteRule&& rule) {
+		scoped_lock lock(m_mutex);
+		const SiteRule& added = m_rules.emplace_back(std::move(rule));
+		for (auto& [key, site] : m_sites) {
+			if (added.Matches(site.sourceLocation) && site.level.load(std::memory_order_relaxed) < added.priority) {
+				site.level.store(added.priority, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	/// @brief Remove all rules and disable all call sites.
+	void Clear() noexcept {
+		scoped_lock lock(m_mutex);
+		m_rules.clear();
+		for (auto& [key, site] : m_sites) {
+			site.level.store(Priority::kNone, std::memory_order_relaxed);
+		}
+	}
+
+private:
+	mutex m_mutex;                                           ///< @brief The mutex for accessing the sites and rules.
+	std::unordered_map<SiteKey, Site, SiteKeyHash> m_sites;  ///< @brief The registered call sites.
+	std::vector<SiteRule> m_rules;                           ///< @brief The rules.
+};
+
+/// @brief The registry of call sites, created when the first rule is added.
+constinit lazy<SiteRegistry> s_siteRegistry;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared by all threads.
+
+/// @brief The call site which has been hit last by the current thread.
+constinit thread_local const Site* s_pLastSite = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
 }  // namespace
 
 namespace internal {
@@ -260,6 +568,111 @@ namespace internal {
 	return result;
 }
 
+/// @brief A preallocated queue for events which are logged while the logger registers with the Windows event log.
+/// @details The data of the events is copied. Events which do not fit into the queue are dropped and counted.
+class PendingEvents final {
+public:
+	[[nodiscard]] PendingEvents() noexcept = default;
+	PendingEvents(const PendingEvents&) = delete;
+	PendingEvents(PendingEvents&&) = delete;
+	~PendingEvents() noexcept = default;
+
+public:
+	PendingEvents& operator=(const PendingEvents&) = delete;
+	PendingEvents& operator=(PendingEvents&&) = delete;
+
+public:
+	/// @brief Add a copy of an event to the queue.
+	/// @details The activity id of the current thread is stored with the event.
+	/// @param event The `EVENT_DESCRIPTOR` containing message, priority and other attributes.
+	/// @param eventArgs The arguments for the event.
+	/// @param pRelatedActivityId An optional pointer to a `GUID` for grouping related events.
+	void Add(const EVENT_DESCRIPTOR& event, LogEventArgs& eventArgs, _In_opt_ const GUID* pRelatedActivityId) noexcept;
+
+	/// @brief Write all events in the queue.
+	/// @details Errors are ignored because there is no caller to report them to.
+	/// @param handle The handle of the registered logger.
+	void WriteAll(REGHANDLE handle) noexcept;
+
+	/// @brief Get the number of events which have been dropped.
+	/// @return The number of events which did not fit into the queue.
+	[[nodiscard]] std::uint32_t GetDropped() const noexcept {
+		return m_dropped;
+	}
+
+public:
+	static constexpr std::uint32_t kCapacity = 16;  ///< @brief The maximum number of events in the queue.
+
+private:
+	static constexpr ULONG kMaxDescriptors = 16;      ///< @brief The maximum number of arguments of a queued event.
+	static constexpr std::size_t kMaxDataSize = 512;  ///< @brief The maximum size of the data of a queued event.
+
+	/// @brief A copy of an event.
+	struct Record final {
+		EVENT_DESCRIPTOR event;                              ///< @brief The event.
+		GUID activityId;                                     ///< @brief The activity id of the logging thread.
+		GUID relatedActivityId;                              ///< @brief The related activity id.
+		bool hasActivityId;                                  ///< @brief `true` if @p activityId is set.
+		bool hasRelatedActivityId;                           ///< @brief `true` if @p relatedActivityId is set.
+		ULONG count;                                         ///< @brief The number of arguments.
+		EVENT_DATA_DESCRIPTOR descriptors[kMaxDescriptors];  // NOLINT(cppcoreguidelines-avoid-c-arrays): Arguments with offsets into data.
+		std::byte data[kMaxDataSize];                        // NOLINT(cppcoreguidelines-avoid-c-arrays): Copy of the argument data.
+	};
+
+	std::array<Record, kCapacity> m_records;  ///< @brief The events.
+	std::uint32_t m_size = 0;                 ///< @brief The number of events in the queue.
+	std::uint32_t m_dropped = 0;              ///< @brief The number of dropped events.
+};
+
+void PendingEvents::Add(const EVENT_DESCRIPTOR& event, LogEventArgs& eventArgs, _In_opt_ const GUID* const pRelatedActivityId) noexcept {
+	const ULONG count = eventArgs.size();
+	if (m_size == kCapacity || count > kMaxDescriptors) {
+		[[unlikely]];
+		++m_dropped;
+		return;
+	}
+
+	Record& record = m_records[m_size];
+	const EVENT_DATA_DESCRIPTOR* const pDescriptors = eventArgs.data();
+	std::size_t offset = 0;
+	for (ULONG i = 0; i < count; ++i) {
+		const ULONG size = pDescriptors[i].Size;
+		if (size > kMaxDataSize - offset) {
+			[[unlikely]];
+			++m_dropped;
+			return;
+		}
+		std::memcpy(&record.data[offset], reinterpret_cast<const void*>(static_cast<ULONG_PTR>(pDescriptors[i].Ptr)), size);
+		record.descriptors[i] = pDescriptors[i];
+		record.descriptors[i].Ptr = offset;
+		offset += size;
+	}
+
+	record.event = event;
+	record.hasActivityId = EventActivityIdControl(EVENT_ACTIVITY_CTRL_GET_ID, &record.activityId) == ERROR_SUCCESS;
+	record.hasRelatedActivityId = pRelatedActivityId != nullptr;
+	if (pRelatedActivityId) {
+		record.relatedActivityId = *pRelatedActivityId;
+	}
+	record.count = count;
+	++m_size;
+}
+
+void PendingEvents::WriteAll(const REGHANDLE handle) noexcept {
+	for (std::uint32_t i = 0; i < m_size; ++i) {
+		Record& record = m_records[i];
+		const ULONGLONG base = reinterpret_cast<ULONG_PTR>(record.data);
+		for (ULONG j = 0; j < record.count; ++j) {
+			record.descriptors[j].Ptr += base;
+		}
+		std::ignore = EventWriteEx(handle, &record.event, 0, 0,
+		                           record.hasActivityId ? &record.activityId : nullptr,
+		                           record.hasRelatedActivityId ? &record.relatedActivityId : nullptr,
+		                           record.count, record.count ? record.descriptors : nullptr);
+	}
+	m_size = 0;
+}
+
 }  // namespace internal
 
 
@@ -286,9 +699,177 @@ void Log::PrintDefault(const Priority priority, const std::string& message) {
 	// no need to check return code; failure to write to stderr will prevent logging
 }
 
-Log& Log::GetInstance() noexcept {
-	static Log instance;
-	return instance;
+constinit lazy<Log> Log::s_instance;
+
+void Log::DoBufferMessage(const Priority priority, const internal::LogContext<const EVENT_DESCRIPTOR&>& context, const internal::ClosureExcept<void, LogData&>&& encode) {
+	LogData logData;
+	encode(logData);
+	if (!s_pLogBuffer) {
+		[[unlikely]];
+		s_pLogBuffer = std::make_unique<LogBuffer>();
+	}
+	s_pLogBuffer->Add(context.GetLogMessage(), priority, context.GetSourceLocation(), std::move(logData));
+}
+
+void Log::FlushBuffer() noexcept {
+	if (!s_pLogBuffer) {
+		return;
+	}
+	s_pLogBuffer->Drain([](const LogBuffer::Record& record) noexcept {
+		const internal::LogContext<const EVENT_DESCRIPTOR&> context(record.event, record.sourceLocation);
+		try {
+			GetInstance().DoLogMessage(
+			    record.priority, context, "",
+			    [&record](_Inout_ LogFormatArgs& formatArgs) {
+				    record.logData.CopyArgumentsTo(formatArgs);
+			    },
+			    [&record](_Inout_ LogEventArgs& eventArgs) {
+				    record.logData.CopyArgumentsTo(eventArgs);
+			    });
+		} catch (...) {
+			GetInstance().LogInternalError(context);
+		}
+	});
+}
+
+void Log::DiscardBuffer() noexcept {
+	if (s_pLogBuffer) {
+		s_pLogBuffer->Clear();
+	}
+}
+
+void Log::SetSampleRate(const std::uint32_t rate) noexcept {
+	InterlockedExchange(&s_sampleMask, static_cast<LONG>(std::bit_ceil(std::clamp(rate, 1u, kMaxSampleRate)) - 1));
+}
+
+bool Log::IsActivitySampled() noexcept {
+	GUID activityId;
+	if (EventActivityIdControl(EVENT_ACTIVITY_CTRL_GET_ID, &activityId) != ERROR_SUCCESS || IsEqualGUID(activityId, GUID{})) {
+		// not part of an activity
+		return true;
+	}
+
+	const LONG mask = ReadNoFence(&s_sampleMask);
+	if (s_sampleDecision.mask != mask || !IsEqualGUID(s_sampleDecision.activityId, activityId)) {
+		s_sampleDecision = {.activityId = activityId, .mask = mask, .sampled = (Hash(activityId) & static_cast<std::uint32_t>(mask)) == 0};
+	}
+	return s_sampleDecision.sampled;
+}
+
+bool Log::IsRegisteredSiteEnabled(const Priority priority, const source_location& sourceLocation) noexcept {
+	const Site* pSite = s_pLastSite;
+	if (!pSite || pSite->sourceLocation.line() != sourceLocation.line() || pSite->sourceLocation.column() != sourceLocation.column() || pSite->sourceLocation.file_name() != sourceLocation.file_name()) {
+		try {
+			pSite = &s_siteRegistry->GetSite(sourceLocation);
+		} catch (...) {
+			// silently ignore errors, the message is just not logged
+			return false;
+		}
+		s_pLastSite = pSite;
+	}
+	return priority <= pSite->level.load(std::memory_order_relaxed);
+}
+
+void Log::EnableFile(const std::string_view pattern, const Priority priority) {
+	s_siteRegistry->AddRule({.filePattern = std::string(pattern), .functionPattern = {}, .first = 0, .last = std::numeric_limits<std::uint_least32_t>::max(), .priority = priority});
+	s_hasSiteRules.store(true, std::memory_order_relaxed);
+}
+
+void Log::EnableFunction(const std::string_view pattern, const Priority priority) {
+	s_siteRegistry->AddRule({.filePattern = {}, .functionPattern = std::string(pattern), .first = 0, .last = std::numeric_limits<std::uint_least32_t>::max(), .priority = priority});
+	s_hasSiteRules.store(true, std::memory_order_relaxed);
+}
+
+void Log::EnableLines(const std::string_view pattern, const std::uint_least32_t first, const std::uint_least32_t last, const Priority priority) {
+	s_siteRegistry->AddRule({.filePattern = std::string(pattern), .functionPattern = {}, .first = first, .last = last, .priority = priority});
+	s_hasSiteRules.store(true, std::memory_order_relaxed);
+}
+
+void Log::DisableSites() noexcept {
+	s_hasSiteRules.store(false, std::memory_order_relaxed);
+	if (s_siteRegistry.has_value()) {
+		s_siteRegistry->Clear();
+	}
+}
+
+void Log::WaitForRegistration() noexcept {
+	const Log& log = GetInstance();
+	if (log.m_registerWork) {
+		WaitForThreadpoolWorkCallbacks(log.m_registerWork, FALSE);
+	}
+}
+
+void Log::RegisterEventsAsync() noexcept {
+	internal::PendingEvents* const pPendingEvents = new (std::nothrow) internal::PendingEvents();
+	if (pPendingEvents) {
+		[[likely]];
+		// set before submitting the work so that the callback always finds the queue
+		s_pPendingEvents.store(pPendingEvents, std::memory_order_release);
+
+		// keep the module loaded while the callback is outstanding because the destructor does not wait for it
+		TP_CALLBACK_ENVIRON environment;
+		InitializeThreadpoolEnvironment(&environment);
+		HMODULE hModule;  // NOLINT(cppcoreguidelines-init-variables): Out parameter.
+		if (GetModuleHandleExW(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT, reinterpret_cast<LPCWSTR>(&RegisterEventsCallback), &hModule)) {
+			[[likely]];
+			SetThreadpoolCallbackLibrary(&environment, hModule);
+		}
+		m_registerWork = CreateThreadpoolWork(&RegisterEventsCallback, this, &environment);
+		DestroyThreadpoolEnvironment(&environment);
+		if (m_registerWork) {
+			[[likely]];
+			SubmitThreadpoolWork(m_registerWork);
+			return;
+		}
+		s_pPendingEvents.store(nullptr, std::memory_order_relaxed);
+		delete pPendingEvents;
+	}
+	RegisterEvents();
+}
+
+void CALLBACK Log::RegisterEventsCallback(PTP_CALLBACK_INSTANCE /* pInstance */, void* const pContext, PTP_WORK /* pWork */) noexcept {
+	// The logger MUST only be accessed while holding the lock and if the queue is still set. Else the logger has
+	// already been destroyed without waiting for the registration.
+	{
+		scoped_lock lock(s_pendingEventsMutex);
+		if (!s_pPendingEvents.load(std::memory_order_relaxed)) {
+			// cancelled before the registration has started
+			return;
+		}
+	}
+
+	REGHANDLE handle = 0;
+	const ULONG result = EventRegister(&kGuid, nullptr, nullptr, &handle);
+
+	scoped_lock lock(s_pendingEventsMutex);
+	internal::PendingEvents* const pPendingEvents = s_pPendingEvents.load(std::memory_order_relaxed);
+	if (!pPendingEvents) {
+		[[unlikely]];
+		if (result == ERROR_SUCCESS) {
+			std::ignore = EventUnregister(handle);
+		}
+		return;
+	}
+
+	Log& log = *static_cast<Log*>(pContext);
+	if (result == ERROR_SUCCESS) {
+		[[likely]];
+		log.m_handle = handle;
+		pPendingEvents->WriteAll(handle);
+	}
+	s_pPendingEvents.store(nullptr, std::memory_order_release);
+	const std::uint32_t dropped = pPendingEvents->GetDropped();
+	delete pPendingEvents;
+
+	// still holding the lock, so the logger cannot be destroyed while logging
+	if (result != ERROR_SUCCESS) {
+		[[unlikely]];
+		Log::Error(evt::Log_Register_E, kGuid, win32_error(result));
+	}
+	if (dropped) {
+		[[unlikely]];
+		Log::Warning(evt::Log_PendingDropped, dropped, internal::PendingEvents::kCapacity);
+	}
 }
 
 void Log::RegisterEvents() noexcept {
@@ -299,6 +880,21 @@ void Log::RegisterEvents() noexcept {
 }
 
 void Log::UnregisterEvents() noexcept {
+	if (m_registerWork) {
+		// MUST NOT wait for the callback because the logger might be destroyed while holding the loader lock of a DLL.
+		// Removing the queue cancels the registration: A callback which has not yet registered the provider returns or
+		// unregisters the provider itself.
+		internal::PendingEvents* pPendingEvents;  // NOLINT(cppcoreguidelines-init-variables): Set while holding the lock.
+		{
+			scoped_lock lock(s_pendingEventsMutex);
+			pPendingEvents = s_pPendingEvents.exchange(nullptr, std::memory_order_relaxed);
+		}
+		delete pPendingEvents;
+
+		// the work object is released when an outstanding callback has finished
+		CloseThreadpoolWork(m_registerWork);
+		m_registerWork = nullptr;
+	}
 	if (m_handle) {
 		const ULONG result = EventUnregister(m_handle);
 		if (result != ERROR_SUCCESS) {
@@ -310,7 +906,7 @@ void Log::UnregisterEvents() noexcept {
 
 template <internal::LogMessage M>
 void Log::LogInternalError(const internal::LogContext<M>& loggedContext) noexcept {
-	const std::source_location& sourceLocation = loggedContext.GetSourceLocation();
+	const source_location& sourceLocation = loggedContext.GetSourceLocation();
 	const auto eventData = [&loggedContext]() noexcept {
 		if constexpr (internal::LogContext<M>::kIsEventDescriptor) {
 			return loggedContext.GetLogMessage().Id;
@@ -375,7 +971,7 @@ _Ret_range_(<, 0) HRESULT Log::ExceptionToHResult(const Priority priority, const
 	}
 }
 
-void Log::Print(const Priority priority, _In_z_ const char* const pattern, const LogFormatArgs& formatArgs, _In_z_ const char* cause, const std::source_location& sourceLocation) {
+void Log::Print(const Priority priority, _In_z_ const char* const pattern, const LogFormatArgs& formatArgs, _In_z_ const char* cause, const source_location& sourceLocation) {
 	const std::string message = fmt::format("{}\n\tat {}({}) ({})\n{}",
 	                                        fmt::vformat(pattern, *formatArgs),
 	                                        sourceLocation.file_name(), sourceLocation.line(), sourceLocation.function_name(),
@@ -384,6 +980,16 @@ void Log::Print(const Priority priority, _In_z_ const char* const pattern, const
 }
 
 void Log::WriteEvent(const EVENT_DESCRIPTOR& event, LogEventArgs& eventArgs, _In_opt_ const GUID* const pRelatedActivityId) const {
+	if (s_pPendingEvents.load(std::memory_order_acquire)) {
+		[[unlikely]];
+		scoped_lock lock(s_pendingEventsMutex);
+		// check again because the registration might have completed in the meantime
+		if (internal::PendingEvents* const pPendingEvents = s_pPendingEvents.load(std::memory_order_relaxed); pPendingEvents) {
+			pPendingEvents->Add(event, eventArgs, pRelatedActivityId);
+			return;
+		}
+	}
+
 	const ULONG count = eventArgs.size();
 	const ULONG result = EventWriteEx(m_handle, &event, 0, 0, nullptr, pRelatedActivityId, count, count ? eventArgs.data() : nullptr);
 	if (result == ERROR_SUCCESS) {
@@ -430,7 +1036,7 @@ void Log::DoWriteException(const Priority priority, const GUID& activityId, _Ino
 
 	LogFormatArgs formatArgs;
 	LogEventArgs eventArgs;
-	const std::source_location* pSourceLocation = nullptr;
+	const source_location* pSourceLocation = nullptr;
 
 	// Container to persist value until end of function.
 	union {  // NOLINT(cppcoreguidelines-pro-type-member-init): Only used locally in blocks, but MUST exist until end of funtion.
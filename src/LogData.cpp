@@ -71,7 +71,6 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SO
 #include <stdexcept>
 #include <string>
 #include <string_view>
-#include <tuple>
 #include <type_traits>
 #include <utility>
 
@@ -110,7 +109,7 @@ struct NonTriviallyCopyable final {
 
 /// @brief The types supported by the logger as arguments. Use `#kTypeId` to get the `#TypeId`.
 /// @copyright This type is derived from `SupportedTypes` from NanoLog.
-using Types = std::tuple<
+using Types = type_list<
     bool,
     char,
     wchar_t,
@@ -141,40 +140,15 @@ using Types = std::tuple<
     NonTriviallyCopyableNoThrowConstructible,
     NonTriviallyCopyable>;
 
-/// @brief Get `#TypeId` of a type at compile time.
-/// @tparam T The type to get the id for.
-/// @tparam Types Supply `#Types` for this parameter.
-/// @copyright The template is copied from `TupleIndex` from NanoLog.
-template <typename T, typename Types>
-struct TypeIndex;
-
-/// @brief Get `#TypeId` at compile time. @details Specialization for the final step in recursive evaluation.
-/// @tparam T The type to get the id for.
-/// @tparam Types The tuple of types.
-/// @copyright The template is copied from `TupleIndex` from NanoLog.
-template <typename T, typename... Types>
-struct TypeIndex<T, std::tuple<T, Types...>> {
-	static constexpr std::uint8_t kValue = 0;  ///< The tuple index.
-};
-
-/// @brief Get `#TypeId` at compile time. @details Specialization for recursive evaluation.
-/// @tparam T The type to get the id for.
-/// @tparam U The next type required for recursive evaluation.
-/// @tparam Types The remaining tuple of types.
-/// @copyright The template is copied from `TupleIndex` from NanoLog.
-template <typename T, typename U, typename... Types>
-struct TypeIndex<T, std::tuple<U, Types...>> {
-	static constexpr std::uint8_t kValue = 1 + TypeIndex<T, std::tuple<Types...>>::kValue;  ///< The tuple index.
-};
-
 /// @brief Type of the type marker in the argument buffer.
 using TypeId = std::uint8_t;
-static_assert(std::tuple_size_v<Types> <= std::numeric_limits<TypeId>::max(), "too many types for type of TypeId");
+static_assert(Types::size <= std::numeric_limits<TypeId>::max(), "too many types for type of TypeId");
 
 /// @brief A constant to get the `#TypeId` of a type at compile time.
 /// @tparam T The type to get the id for.
 template <typename T>
-constexpr TypeId kTypeId = TypeIndex<T, Types>::kValue;
+requires contains_v<T, Types>
+constexpr TypeId kTypeId = index_of_v<T, Types>;
 
 /// @brief Pre-calculated array of sizes required to store values in the buffer. Use `#kTypeSize` to get the size in code.
 /// @hideinitializer
@@ -210,7 +184,7 @@ constexpr std::uint8_t kTypeSizes[] = {
     sizeof(TypeId) + sizeof(FunctionTableNonTrivial*) /* + std::byte[padding] + std::byte[sizeof(arg)] */             // NOLINT(bugprone-sizeof-expression): Get size of pointer.
 };
 
-static_assert(std::tuple_size_v<Types> == sizeof(kTypeSizes) / sizeof(kTypeSizes[0]), "length of kTypeSizes does not match Types");
+static_assert(Types::size == sizeof(kTypeSizes) / sizeof(kTypeSizes[0]), "length of kTypeSizes does not match Types");
 
 /// @brief A constant to get the (basic) buffer size of a type at compile time.
 /// @tparam T The type to get the id for.
@@ -739,6 +713,7 @@ void CallDestructors(_Inout_updates_bytes_(used) std::byte* __restrict buffer, S
 LogDataBase::LogDataBase(const LogDataBase& other) noexcept
     : m_hasHeapBuffer(other.m_hasHeapBuffer)
     , m_hasNonTriviallyCopyable(other.m_hasNonTriviallyCopyable)
+    , m_hasNonTriviallyRelocatable(other.m_hasNonTriviallyRelocatable)
     , m_used(other.m_used) {
 	if (m_hasHeapBuffer) {
 		[[unlikely]];
@@ -758,6 +733,7 @@ LogDataBase::LogDataBase(const LogDataBase& other) noexcept
 LogDataBase::LogDataBase(LogDataBase&& other) noexcept
     : m_hasHeapBuffer(other.m_hasHeapBuffer)
     , m_hasNonTriviallyCopyable(other.m_hasNonTriviallyCopyable)
+    , m_hasNonTriviallyRelocatable(other.m_hasNonTriviallyRelocatable)
     , m_used(other.m_used) {
 	// copy
 	if (m_hasHeapBuffer) {
@@ -767,7 +743,7 @@ LogDataBase::LogDataBase(LogDataBase&& other) noexcept
 		std::destroy_at(&other.GetHeapBuffer());
 		other.m_hasHeapBuffer = false;
 	} else {
-		if (m_hasNonTriviallyCopyable) {
+		if (m_hasNonTriviallyRelocatable) {
 			[[unlikely]];
 			MoveObjects(other.m_stackBuffer, m_stackBuffer, m_used);
 		} else {
@@ -776,6 +752,7 @@ LogDataBase::LogDataBase(LogDataBase&& other) noexcept
 	}
 	// leave source in a consistent state
 	other.m_hasNonTriviallyCopyable = false;
+	other.m_hasNonTriviallyRelocatable = false;
 	other.m_used = 0;
 }
 
@@ -812,6 +789,7 @@ LogDataBase& LogDataBase::operator=(const LogDataBase& other) noexcept {
 
 		// copy
 		m_hasNonTriviallyCopyable = other.m_hasNonTriviallyCopyable;
+		m_hasNonTriviallyRelocatable = other.m_hasNonTriviallyRelocatable;
 		m_used = other.m_used;
 		if (other.m_hasHeapBuffer) {
 			[[unlikely]];
@@ -851,6 +829,7 @@ LogDataBase& LogDataBase::operator=(LogDataBase&& other) noexcept {
 
 		// copy
 		m_hasNonTriviallyCopyable = other.m_hasNonTriviallyCopyable;
+		m_hasNonTriviallyRelocatable = other.m_hasNonTriviallyRelocatable;
 		m_used = other.m_used;
 		if (other.m_hasHeapBuffer) {
 			[[unlikely]];
@@ -870,7 +849,7 @@ LogDataBase& LogDataBase::operator=(LogDataBase&& other) noexcept {
 				std::destroy_at(&GetHeapBuffer());
 				m_hasHeapBuffer = false;
 			}
-			if (m_hasNonTriviallyCopyable) {
+			if (m_hasNonTriviallyRelocatable) {
 				[[unlikely]];
 				MoveObjects(other.m_stackBuffer, m_stackBuffer, m_used);
 			} else {
@@ -879,6 +858,7 @@ LogDataBase& LogDataBase::operator=(LogDataBase&& other) noexcept {
 		}
 		// leave source in a consistent state
 		other.m_hasNonTriviallyCopyable = false;
+		other.m_hasNonTriviallyRelocatable = false;
 		other.m_used = 0;
 	}
 	return *this;
@@ -1007,7 +987,7 @@ _Ret_notnull_ __declspec(restrict) std::byte* LogDataBase::GetWritePosition(cons
 		// assert that both buffers are equally aligned so that any offsets and padding values can be simply copied
 		assert(reinterpret_cast<std::uintptr_t>(m_stackBuffer) % __STDCPP_DEFAULT_NEW_ALIGNMENT__ == reinterpret_cast<std::uintptr_t>(newHeapBuffer.get()) % __STDCPP_DEFAULT_NEW_ALIGNMENT__);
 
-		if (m_hasNonTriviallyCopyable) {
+		if (m_hasNonTriviallyRelocatable) {
 			[[unlikely]];
 			MoveObjects(m_stackBuffer, newHeapBuffer.get(), m_used);
 		} else {
@@ -1019,7 +999,7 @@ _Ret_notnull_ __declspec(restrict) std::byte* LogDataBase::GetWritePosition(cons
 		// assert that both buffers are equally aligned so that any offsets and padding values can be simply copied
 		assert(reinterpret_cast<std::uintptr_t>(GetHeapBuffer().get()) % __STDCPP_DEFAULT_NEW_ALIGNMENT__ == reinterpret_cast<std::uintptr_t>(newHeapBuffer.get()) % __STDCPP_DEFAULT_NEW_ALIGNMENT__);
 
-		if (m_hasNonTriviallyCopyable) {
+		if (m_hasNonTriviallyRelocatable) {
 			[[unlikely]];
 			MoveObjects(GetHeapBuffer().get(), newHeapBuffer.get(), m_used);
 		} else {
@@ -1127,7 +1107,7 @@ void LogDataBase::WriteSID(const SID& arg) {
 	m_used += size + padding;
 }
 
-template <bool kTriviallyCopyable, bool kNoThrowConstructible>
+template <bool kTriviallyCopyable, bool kNoThrowConstructible, bool kTriviallyRelocatable>
 void* LogDataBase::WriteCustomType(_In_ const FunctionTable* __restrict const pFunctionTable) {
 	using Type = std::conditional_t<kTriviallyCopyable, TriviallyCopyable, std::conditional_t<kNoThrowConstructible, NonTriviallyCopyableNoThrowConstructible, NonTriviallyCopyable>>;
 	constexpr TypeId kId = kTypeId<Type>;
@@ -1149,13 +1129,18 @@ void* LogDataBase::WriteCustomType(_In_ const FunctionTable* __restrict const pF
 	if constexpr (!kTriviallyCopyable) {
 		m_hasNonTriviallyCopyable = true;
 	}
+	if constexpr (!kTriviallyRelocatable) {
+		m_hasNonTriviallyRelocatable = true;
+	}
 	return &buffer[kArgSize + padding];
 }
 
-template void* LogDataBase::WriteCustomType<false, false>(_In_ const FunctionTable* __restrict);
-template void* LogDataBase::WriteCustomType<false, true>(_In_ const FunctionTable* __restrict);
-template void* LogDataBase::WriteCustomType<true, true>(_In_ const FunctionTable* __restrict);
-// true, false not required
+template void* LogDataBase::WriteCustomType<false, false, false>(_In_ const FunctionTable* __restrict);
+template void* LogDataBase::WriteCustomType<false, false, true>(_In_ const FunctionTable* __restrict);
+template void* LogDataBase::WriteCustomType<false, true, false>(_In_ const FunctionTable* __restrict);
+template void* LogDataBase::WriteCustomType<false, true, true>(_In_ const FunctionTable* __restrict);
+template void* LogDataBase::WriteCustomType<true, true, true>(_In_ const FunctionTable* __restrict);
+// true, false and true, true, false not required
 
 
 namespace {
@@ -1211,6 +1196,12 @@ private:
 }  // namespace
 }  // namespace m3c::internal
 
+/// @brief A `VariantWrapper` holds no pointers to itself and may be moved using `std::memcpy`.
+template <>
+struct m3c::is_trivially_relocatable<m3c::internal::VariantWrapper> : std::true_type {
+	// empty
+};
+
 
 void operator>>(const VARIANT& arg, _Inout_ m3c::LogData& logData) {
 	if (arg.vt & VT_BYREF) {
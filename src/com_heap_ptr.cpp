@@ -19,6 +19,7 @@ limitations under the License.
 #include "m3c/com_heap_ptr.h"
 
 #include "m3c/exception.h"
+#include "m3c/leak_tracker.h"
 
 #include "m3c.events.h"
 
@@ -48,6 +49,7 @@ _Ret_notnull_ void* com_heap_ptr_base::reallocate(_In_opt_ void* const ptr, cons
 }
 
 void com_heap_ptr_base::deallocate(_In_opt_ void* const ptr) noexcept {
+	leak_tracker::untrack(ptr);
 	CoTaskMemFree(ptr);
 }
 
@@ -0,0 +1,268 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/directory_iterator.h"
+
+#include "m3c/Log.h"
+#include "m3c/exception.h"
+#include "m3c/mutex.h"
+
+#include "m3c.events.h"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace m3c {
+
+namespace {
+
+/// @brief The size of the buffer for reading directory entries.
+/// @details 64 KiB is the maximum size supported for network shares.
+constexpr DWORD kBufferSize = 64u * 1024u;
+
+/// @brief Open a directory for enumeration without throwing an exception.
+/// @param path The path of the directory.
+/// @return The directory handle which is invalid if the directory cannot be opened.
+[[nodiscard]] Handle TryOpenDirectory(_In_z_ const wchar_t* const path) noexcept {
+	return CreateFileW(path, FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+}
+
+/// @brief Open a directory for enumeration.
+/// @param path The path of the directory.
+/// @return The directory handle.
+[[nodiscard]] Handle OpenDirectory(_In_z_ const wchar_t* const path) {
+	Handle directory = TryOpenDirectory(path);
+	if (!directory) {
+		[[unlikely]];
+		throw windows_error() + evt::directory_iterator_Open_E;
+	}
+	return directory;
+}
+
+/// @brief Check if `walk_directory` skips a subdirectory which cannot be opened.
+/// @param error The error code of opening the subdirectory.
+/// @return `true` if the subdirectory is skipped, `false` if the walk fails.
+[[nodiscard]] constexpr bool IsSkippable(const DWORD error) noexcept {
+	return error == ERROR_ACCESS_DENIED || error == ERROR_FILE_NOT_FOUND || error == ERROR_PATH_NOT_FOUND;
+}
+
+/// @brief The shared state of the threads of `walk_directory`.
+class DirectoryWalker final {
+public:
+	/// @brief Creates a new walker.
+	/// @param root The path of the root directory.
+	/// @param callback The callback for all entries.
+	[[nodiscard]] DirectoryWalker(const std::wstring& root, const walk_callback& callback)
+	    : m_root(root)
+	    , m_callback(callback)
+	    , m_directories({root}) {
+		// empty
+	}
+
+	DirectoryWalker(const DirectoryWalker&) = delete;
+	DirectoryWalker(DirectoryWalker&&) = delete;
+	~DirectoryWalker() noexcept = default;
+
+public:
+	DirectoryWalker& operator=(const DirectoryWalker&) = delete;
+	DirectoryWalker& operator=(DirectoryWalker&&) = delete;
+
+public:
+	/// @brief Scan directories from the queue until all directories have been scanned or an error has occurred.
+	void Run() noexcept {
+		try {
+			std::wstring directory;
+			std::vector<std::wstring> subdirectories;
+			while (Next(directory, subdirectories)) {
+				subdirectories.clear();
+				Scan(directory, subdirectories);
+			}
+		} catch (...) {
+			scoped_lock lock(m_mutex);
+			if (!m_exception) {
+				m_exception = std::current_exception();
+			}
+			m_changed.notify_all();
+		}
+	}
+
+	/// @brief Rethrow the first exception which has occurred in any thread.
+	void RethrowIfFailed() const {
+		if (m_exception) {
+			[[unlikely]];
+			std::rethrow_exception(m_exception);
+		}
+	}
+
+private:
+	/// @brief Publish the results of the previous scan and take the next directory from the queue.
+	/// @param directory The directory of the previous scan, empty on the first call. Receives the next directory.
+	/// @param subdirectories The subdirectories found by the previous scan.
+	/// @return `true` if @p directory is set, `false` if the walk has finished.
+	[[nodiscard]] bool Next(_Inout_ std::wstring& directory, _Inout_ std::vector<std::wstring>& subdirectories) {
+		scoped_lock lock(m_mutex);
+		if (!directory.empty()) {
+			--m_active;
+			m_directories.insert(m_directories.end(), std::make_move_iterator(subdirectories.begin()), std::make_move_iterator(subdirectories.end()));
+			m_changed.notify_all();
+		}
+		m_changed.wait(lock, [this] {
+			return !m_directories.empty() || !m_active || m_exception;
+		});
+		if (m_exception || m_directories.empty()) {
+			return false;
+		}
+		directory = std::move(m_directories.back());
+		m_directories.pop_back();
+		++m_active;
+		return true;
+	}
+
+	/// @brief Report all entries of a directory.
+	/// @details A subdirectory which cannot be opened because access is denied or because it has been removed is
+	/// logged and skipped.
+	/// @param directory The path of the directory.
+	/// @param subdirectories Receives the paths of all subdirectories which are not reparse points.
+	void Scan(const std::wstring& directory, _Inout_ std::vector<std::wstring>& subdirectories) const {
+		Handle handle = TryOpenDirectory(directory.c_str());
+		if (!handle) {
+			[[unlikely]];
+			const DWORD lastError = GetLastError();
+			if (directory == m_root || !IsSkippable(lastError)) {
+				throw windows_error(lastError) + evt::directory_iterator_Open_E;
+			}
+			Log::Warning(evt::directory_iterator_Skip_E, directory, win32_error(lastError));
+			return;
+		}
+
+		const bool separator = directory.ends_with(L'\\');
+		for (const directory_entry& entry : directory_iterator(std::move(handle))) {
+			m_callback(directory, entry);
+			if (entry.is_directory() && !(entry.attributes & FILE_ATTRIBUTE_REPARSE_POINT)) {
+				std::wstring& path = subdirectories.emplace_back();
+				path.reserve(directory.size() + 1 + entry.name.size());
+				path.append(directory);
+				if (!separator) {
+					path.push_back(L'\\');
+				}
+				path.append(entry.name);
+			}
+		}
+	}
+
+private:
+	const std::wstring& m_root;               ///< @brief The path of the root directory.
+	const walk_callback& m_callback;          ///< @brief The callback for all entries.
+	mutex m_mutex;                            ///< @brief The mutex for the queue.
+	condition_variable m_changed;             ///< @brief Signaled when the queue or the number of active threads changes.
+	std::vector<std::wstring> m_directories;  ///< @brief The queue of directories waiting to be scanned.
+	std::uint32_t m_active = 0;               ///< @brief The number of threads currently scanning a directory.
+	std::exception_ptr m_exception;           ///< @brief The first exception which has occurred.
+};
+
+}  // namespace
+
+/// @brief The shared state of `directory_iterator`.
+struct directory_iterator::State final {
+	Handle directory;                                 ///< @brief The directory handle.
+	std::unique_ptr<std::byte[]> buffer;              // NOLINT(cppcoreguidelines-avoid-c-arrays): Buffer for a batch of entries.
+	const FILE_ID_BOTH_DIR_INFO* pCurrent = nullptr;  ///< @brief The current entry in `buffer`.
+	directory_entry entry;                            ///< @brief The data of the current entry.
+};
+
+directory_iterator::directory_iterator(_In_z_ const wchar_t* const path)
+    : directory_iterator(OpenDirectory(path)) {
+	// empty
+}
+
+directory_iterator::directory_iterator(Handle&& directory)
+    : m_pState(std::make_shared<State>(std::move(directory), std::make_unique_for_overwrite<std::byte[]>(kBufferSize))) {  // NOLINT(cppcoreguidelines-avoid-c-arrays): Buffer for a batch of entries.
+	Next();
+}
+
+const directory_entry& directory_iterator::operator*() const noexcept {
+	return m_pState->entry;
+}
+
+directory_iterator& directory_iterator::operator++() {
+	Next();
+	return *this;
+}
+
+void directory_iterator::Next() {
+	State& state = *m_pState;
+	while (true) {
+		if (state.pCurrent && state.pCurrent->NextEntryOffset) {
+			state.pCurrent = reinterpret_cast<const FILE_ID_BOTH_DIR_INFO*>(reinterpret_cast<const std::byte*>(state.pCurrent) + state.pCurrent->NextEntryOffset);
+		} else {
+			if (!GetFileInformationByHandleEx(state.directory, FileIdBothDirectoryInfo, state.buffer.get(), kBufferSize)) {
+				if (const DWORD lastError = GetLastError(); lastError != ERROR_NO_MORE_FILES) {
+					[[unlikely]];
+					throw windows_error(lastError) + evt::directory_iterator_Read_E;
+				}
+				m_pState.reset();
+				return;
+			}
+			state.pCurrent = reinterpret_cast<const FILE_ID_BOTH_DIR_INFO*>(state.buffer.get());
+		}
+
+		const FILE_ID_BOTH_DIR_INFO& info = *state.pCurrent;
+		const std::wstring_view name(info.FileName, info.FileNameLength / sizeof(wchar_t));
+		if (name == L"." || name == L"..") {
+			continue;
+		}
+		state.entry = {.name = name,
+		               .attributes = info.FileAttributes,
+		               .size = static_cast<std::uint64_t>(info.EndOfFile.QuadPart),
+		               .lastWriteTime = info.LastWriteTime.QuadPart,
+		               .fileId = static_cast<std::uint64_t>(info.FileId.QuadPart)};
+		return;
+	}
+}
+
+void walk_directory(const std::wstring& root, const walk_callback& callback, std::uint32_t threads) {
+	if (!threads) {
+		threads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	DirectoryWalker walker(root, callback);
+	{
+		std::vector<std::jthread> workers;
+		workers.reserve(threads - 1);
+		for (std::uint32_t i = 1; i < threads; ++i) {
+			workers.emplace_back([&walker] {
+				walker.Run();
+			});
+		}
+		walker.Run();
+	}
+	walker.RethrowIfFailed();
+}
+
+}  // namespace m3c
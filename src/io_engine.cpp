@@ -0,0 +1,176 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/io_engine.h"
+
+#include "m3c/exception.h"
+
+#include "m3c.events.h"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace m3c {
+
+namespace {
+
+/// @brief The maximum number of completions dequeued in one call.
+constexpr ULONG kBatchSize = 64;
+
+/// @brief The state of an outstanding operation.
+/// @details The `OVERLAPPED` structure MUST be the first member because the pointer is returned by the completion port.
+struct Operation final {
+	OVERLAPPED overlapped;         ///< @brief The `OVERLAPPED` structure for the Windows API.
+	HANDLE hFile;                  ///< @brief The file for retrieving the result.
+	io_engine::Callback callback;  ///< @brief The callback which receives the result.
+	DWORD error;                   ///< @brief The error if the operation has failed synchronously, else `ERROR_SUCCESS`.
+};
+
+/// @brief Get the size of a buffer for the Windows API.
+/// @param size The size of the buffer in bytes.
+/// @return The size as a `DWORD`.
+[[nodiscard]] DWORD GetBufferSize(const std::size_t size) {
+	if (size > std::numeric_limits<DWORD>::max()) {
+		[[unlikely]];
+		throw std::length_error("io_engine") + evt::Default;
+	}
+	return static_cast<DWORD>(size);
+}
+
+}  // namespace
+
+io_engine::io_engine(const DWORD concurrency) {
+	const HANDLE hPort = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, concurrency);
+	if (!hPort) {
+		[[unlikely]];
+		throw windows_error() + evt::io_engine_CreatePort_E;
+	}
+	m_port = hPort;
+}
+
+void io_engine::associate(const Handle& file) {
+	if (!CreateIoCompletionPort(file, m_port, 0, 0)) {
+		[[unlikely]];
+		throw windows_error() + evt::io_engine_Associate_E;
+	}
+	// no need to signal the file handle because completion is reported using the port
+	if (!SetFileCompletionNotificationModes(file, FILE_SKIP_SET_EVENT_ON_HANDLE)) {
+		[[unlikely]];
+		throw windows_error() + evt::io_engine_Associate_E;
+	}
+}
+
+void io_engine::read(const Handle& file, const std::uint64_t offset, const std::span<std::byte> buffer, Callback callback) {
+	Submit(file, offset, buffer.data(), GetBufferSize(buffer.size()), false, std::move(callback));
+}
+
+void io_engine::write(const Handle& file, const std::uint64_t offset, const std::span<const std::byte> buffer, Callback callback) {
+	Submit(file, offset, const_cast<std::byte*>(buffer.data()), GetBufferSize(buffer.size()), true, std::move(callback));  // NOLINT(cppcoreguidelines-pro-type-const-cast): Buffer is only read.
+}
+
+io_engine::awaitable io_engine::read_async(const Handle& file, const std::uint64_t offset, const std::span<std::byte> buffer) noexcept {
+	return awaitable(*this, file, offset, buffer, false);
+}
+
+io_engine::awaitable io_engine::write_async(const Handle& file, const std::uint64_t offset, const std::span<const std::byte> buffer) noexcept {
+	return awaitable(*this, file, offset, std::span(const_cast<std::byte*>(buffer.data()), buffer.size()), true);  // NOLINT(cppcoreguidelines-pro-type-const-cast): Buffer is only read.
+}
+
+void io_engine::Submit(const Handle& file, const std::uint64_t offset, _In_reads_bytes_(size) void* const pBuffer, const DWORD size, const bool write, Callback&& callback) {
+	auto pOperation = std::make_unique<Operation>(Operation{.overlapped = {}, .hFile = file, .callback = std::move(callback), .error = ERROR_SUCCESS});
+	pOperation->overlapped.Offset = static_cast<DWORD>(offset);
+	pOperation->overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32u);
+
+	m_pending.fetch_add(1, std::memory_order_relaxed);
+	const BOOL result = write ? WriteFile(file, pBuffer, size, nullptr, &pOperation->overlapped)
+	                          : ReadFile(file, pBuffer, size, nullptr, &pOperation->overlapped);
+	if (!result) {
+		if (const DWORD lastError = GetLastError(); lastError != ERROR_IO_PENDING) {
+			// no completion is queued for synchronous errors (e.g. ERROR_HANDLE_EOF), report them from poll as well
+			pOperation->error = lastError;
+			if (!PostQueuedCompletionStatus(m_port, 0, 0, &pOperation->overlapped)) {
+				[[unlikely]];
+				m_pending.fetch_sub(1, std::memory_order_relaxed);
+				if (write) {
+					throw windows_error() + evt::io_engine_Write_E;
+				}
+				throw windows_error() + evt::io_engine_Read_E;
+			}
+		}
+	}
+	// completion is always posted to the port, both for immediate and pending results
+	static_cast<void>(pOperation.release());
+}
+
+std::size_t io_engine::poll(const std::chrono::milliseconds timeout) {
+	std::array<OVERLAPPED_ENTRY, kBatchSize> entries;  // NOLINT(cppcoreguidelines-pro-type-member-init): Filled by GetQueuedCompletionStatusEx.
+	ULONG count;                                        // NOLINT(cppcoreguidelines-init-variables): Out parameter.
+	const DWORD milliseconds = static_cast<DWORD>(std::clamp<std::chrono::milliseconds::rep>(timeout.count(), 0, INFINITE));
+	if (!GetQueuedCompletionStatusEx(m_port, entries.data(), kBatchSize, &count, milliseconds, FALSE)) {
+		if (const DWORD lastError = GetLastError(); lastError != WAIT_TIMEOUT) {
+			[[unlikely]];
+			throw windows_error(lastError) + evt::io_engine_Wait_E;
+		}
+		return 0;
+	}
+
+	// take ownership of all operations first, so that an exception in a callback does not leak the others
+	std::array<std::unique_ptr<Operation>, kBatchSize> operations;
+	for (ULONG i = 0; i < count; ++i) {
+		operations[i].reset(CONTAINING_RECORD(entries[i].lpOverlapped, Operation, overlapped));
+	}
+	m_pending.fetch_sub(count, std::memory_order_relaxed);
+
+	// run all callbacks even if one throws, else operations awaited by coroutines would never resume
+	std::exception_ptr exception;
+	for (ULONG i = 0; i < count; ++i) {
+		Operation& operation = *operations[i];
+		io_result result = {operation.error, entries[i].dwNumberOfBytesTransferred};
+		DWORD bytes;  // NOLINT(cppcoreguidelines-init-variables): Out parameter.
+		if (result.error == ERROR_SUCCESS && !GetOverlappedResult(operation.hFile, &operation.overlapped, &bytes, FALSE)) {
+			result.error = GetLastError();
+		}
+		try {
+			operation.callback(result);
+		} catch (...) {
+			if (!exception) {
+				exception = std::current_exception();
+			}
+		}
+	}
+	if (exception) {
+		[[unlikely]];
+		std::rethrow_exception(exception);
+	}
+	return count;
+}
+
+void io_engine::run() {
+	while (pending()) {
+		poll(std::chrono::milliseconds(INFINITE));
+	}
+}
+
+}  // namespace m3c
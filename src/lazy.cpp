@@ -0,0 +1,44 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/lazy.h"
+
+#include <windows.h>
+
+namespace m3c {
+
+bool once_flag::Enter() noexcept {
+	while (true) {
+		const LONG state = InterlockedCompareExchange(&m_state, kRunning, kInitial);
+		if (state == kInitial) {
+			return true;
+		}
+		if (state == kDone) {
+			return false;
+		}
+		LONG running = kRunning;
+		WaitOnAddress(&m_state, &running, sizeof(running), INFINITE);
+	}
+}
+
+void once_flag::Leave(const bool success) noexcept {
+	InterlockedExchange(&m_state, success ? kDone : kInitial);
+	WakeByAddressAll(const_cast<LONG*>(&m_state));  // NOLINT(cppcoreguidelines-pro-type-const-cast): API requires non-volatile pointer.
+}
+
+}  // namespace m3c
@@ -0,0 +1,324 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/leak_tracker.h"
+
+#include "m3c/Log.h"
+#include "m3c/lazy.h"
+#include "m3c/mutex.h"
+
+#include "m3c.events.h"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace m3c {
+
+namespace {
+
+/// @brief The number of shards, MUST be a power of two.
+constexpr std::size_t kShardCount = 16;
+
+// The hash value is split into separate bit ranges for selecting the shard (lowest bits), for sampling (the bits above)
+// and for the home slot in the shard (upper 32 bits). The ranges MUST NOT overlap: Sampled keys have all sampling bits
+// set to zero, so if these bits also selected the shard or the slot, all sampled keys would share a few shards or slots.
+
+/// @brief The first bit of the hash value used for sampling.
+constexpr std::uint32_t kSampleShift = std::bit_width(kShardCount - 1);
+
+/// @brief The first bit of the hash value used for the home slot in a shard.
+constexpr std::uint32_t kIndexShift = 32;
+
+/// @brief The maximum sampling rate which keeps the sampling bits below `kIndexShift`.
+constexpr std::uint32_t kMaxSampleRate = 1u << (kIndexShift - kSampleShift);
+
+/// @brief The initial number of slots of a shard, MUST be a power of two.
+constexpr std::size_t kInitialCapacity = 64;
+
+/// @brief The mask for selecting sampled resources, `0` to track all resources.
+constinit volatile LONG s_sampleMask = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Configuration set at runtime.
+
+/// @brief Mix all bits of a key because handle values and pointers have many constant low bits.
+/// @param key The native handle or pointer.
+/// @return The hash value.
+[[nodiscard]] constexpr std::uint64_t Hash(_In_ const void* const key) noexcept {
+	// finalizer of splitmix64
+	std::uint64_t hash = reinterpret_cast<std::uintptr_t>(key);
+	hash = (hash ^ (hash >> 30u)) * 0xBF58476D1CE4E5B9u;
+	hash = (hash ^ (hash >> 27u)) * 0x94D049BB133111EBu;
+	return hash ^ (hash >> 31u);
+}
+
+/// @brief Check if a resource is sampled.
+/// @param hash The hash value of the key.
+/// @return `true` if the resource is tracked.
+[[nodiscard]] bool IsSampled(const std::uint64_t hash) noexcept {
+	return ((hash >> kSampleShift) & static_cast<std::uint32_t>(ReadNoFence(&s_sampleMask))) == 0;
+}
+
+/// @brief A part of the table with its own lock.
+/// @details The shard uses linear probing. A slot is empty if the key is `nullptr`.
+class Shard final {
+public:
+	[[nodiscard]] Shard() noexcept = default;
+	Shard(const Shard&) = delete;
+	Shard(Shard&&) = delete;
+	~Shard() noexcept = default;
+
+public:
+	Shard& operator=(const Shard&) = delete;
+	Shard& operator=(Shard&&) = delete;
+
+public:
+	/// @brief Add a resource.
+	/// @param hash The hash value of the key.
+	/// @param resource The resource.
+	void Insert(const std::uint64_t hash, const tracked_resource& resource) noexcept {
+		scoped_lock lock(m_mutex);
+		if ((m_size + 1) * 2 > m_slots.size()) {
+			[[unlikely]];
+			try {
+				Grow();
+			} catch (const std::bad_alloc&) {
+				// tracking is best effort
+				return;
+			}
+		}
+		tracked_resource& slot = Find(hash, resource.key);
+		if (!slot.key) {
+			++m_size;
+		}
+		slot = resource;
+	}
+
+	/// @brief Remove a resource.
+	/// @param hash The hash value of the key.
+	/// @param key The native handle or pointer.
+	void Erase(const std::uint64_t hash, _In_ const void* const key) noexcept {
+		scoped_lock lock(m_mutex);
+		if (!m_size) {
+			return;
+		}
+		tracked_resource* pSlot = &Find(hash, key);
+		if (!pSlot->key) {
+			return;
+		}
+
+		// backward shift deletion keeps all probe sequences intact without tombstones
+		const std::size_t mask = m_slots.size() - 1;
+		std::size_t hole = static_cast<std::size_t>(pSlot - m_slots.data());
+		for (std::size_t index = (hole + 1) & mask; m_slots[index].key; index = (index + 1) & mask) {
+			const std::size_t home = Index(Hash(m_slots[index].key));
+			// move the entry if the hole lies between its home slot and its current position
+			if (((index - home) & mask) >= ((index - hole) & mask)) {
+				m_slots[hole] = m_slots[index];
+				hole = index;
+			}
+		}
+		m_slots[hole].key = nullptr;
+		--m_size;
+	}
+
+	/// @brief Get the number of resources.
+	/// @return The number of resources in the shard.
+	[[nodiscard]] std::size_t Size() noexcept {
+		scoped_lock lock(m_mutex);
+		return m_size;
+	}
+
+	/// @brief Copy all resources.
+	/// @param resources Receives the resources.
+	void CopyTo(_Inout_ std::vector<tracked_resource>& resources) {
+		scoped_lock lock(m_mutex);
+		resources.reserve(resources.size() + m_size);
+		for (const tracked_resource& slot : m_slots) {
+			if (slot.key) {
+				resources.push_back(slot);
+			}
+		}
+	}
+
+private:
+	/// @brief Get the home slot for a hash value.
+	/// @param hash The hash value of the key.
+	/// @return The index of the first slot of the probe sequence.
+	[[nodiscard]] std::size_t Index(const std::uint64_t hash) const noexcept {
+		return static_cast<std::size_t>(hash >> kIndexShift) & (m_slots.size() - 1);
+	}
+
+	/// @brief Get the slot of a key.
+	/// @param hash The hash value of the key.
+	/// @param key The native handle or pointer.
+	/// @return The slot holding @p key or the empty slot where @p key can be added.
+	[[nodiscard]] tracked_resource& Find(const std::uint64_t hash, _In_ const void* const key) noexcept {
+		const std::size_t mask = m_slots.size() - 1;
+		for (std::size_t index = Index(hash);; index = (index + 1) & mask) {
+			tracked_resource& slot = m_slots[index];
+			if (slot.key == key || !slot.key) {
+				return slot;
+			}
+		}
+	}
+
+	/// @brief Double the number of slots.
+	void Grow() {
+		std::vector<tracked_resource> slots(std::max(m_slots.size() * 2, kInitialCapacity));
+		std::swap(m_slots, slots);
+		for (const tracked_resource& slot : slots) {
+			if (slot.key) {
+				Find(Hash(slot.key), slot.key) = slot;
+			}
+		}
+	}
+
+private:
+	mutex m_mutex;                          ///< @brief The lock for the shard.
+	std::vector<tracked_resource> m_slots;  ///< @brief The slots, the size is zero or a power of two.
+	std::size_t m_size = 0;                 ///< @brief The number of resources.
+};
+
+/// @brief The table of all tracked resources.
+/// @details The object is never destroyed because handles might be released during static destruction.
+class ResourceTable final {
+public:
+	/// @brief Get the single instance.
+	/// @return The instance or `nullptr` if it could not be created.
+	[[nodiscard]] static ResourceTable* GetInstance() noexcept {
+		call_once(s_once, []() noexcept {
+			s_pInstance = new (std::nothrow) ResourceTable();
+		});
+		return s_pInstance;
+	}
+
+	/// @brief Get the shard for a hash value.
+	/// @param hash The hash value of the key.
+	/// @return The shard.
+	[[nodiscard]] Shard& GetShard(const std::uint64_t hash) noexcept {
+		return m_shards[hash & (kShardCount - 1)].shard;
+	}
+
+	/// @brief Get all shards.
+	/// @return The shards.
+	[[nodiscard]] auto& GetShards() noexcept {
+		return m_shards;
+	}
+
+private:
+	/// @brief Padding to place each shard in its own cache line.
+	struct alignas(std::hardware_destructive_interference_size) AlignedShard final {
+		Shard shard;  ///< @brief The shard.
+	};
+
+	std::array<AlignedShard, kShardCount> m_shards;  ///< @brief The shards.
+
+	static constinit inline once_flag s_once;                        ///< @brief Guards the creation of the instance.
+	static constinit inline ResourceTable* s_pInstance = nullptr;  ///< @brief The single instance.
+};
+
+}  // namespace
+
+void leak_tracker::set_sample_rate(const std::uint32_t rate) noexcept {
+	InterlockedExchange(&s_sampleMask, static_cast<LONG>(std::bit_ceil(std::clamp(rate, 1u, kMaxSampleRate)) - 1));
+}
+
+std::size_t leak_tracker::size() noexcept {
+	ResourceTable* const pTable = ResourceTable::GetInstance();
+	if (!pTable) {
+		[[unlikely]];
+		return 0;
+	}
+	std::size_t size = 0;
+	for (auto& shard : pTable->GetShards()) {
+		size += shard.shard.Size();
+	}
+	return size;
+}
+
+void leak_tracker::for_each(const std::function<void(const tracked_resource&)>& callback) {
+	ResourceTable* const pTable = ResourceTable::GetInstance();
+	if (!pTable) {
+		[[unlikely]];
+		return;
+	}
+	// copy the entries because the callback might acquire or release resources itself
+	std::vector<tracked_resource> resources;
+	for (auto& shard : pTable->GetShards()) {
+		resources.clear();
+		shard.shard.CopyTo(resources);
+		for (const tracked_resource& resource : resources) {
+			callback(resource);
+		}
+	}
+}
+
+void leak_tracker::dump() noexcept {
+	try {
+		for_each([](const tracked_resource& resource) {
+			const char* const file = resource.location.file_name();
+			const std::uint32_t line = resource.location.line();
+			const char* const function = resource.location.function_name();
+			Log::Warning(evt::ResourceLeak, resource.key, file, line, function, resource.threadId);
+		});
+	} catch (...) {
+		Log::ErrorException(evt::leak_tracker_Dump);
+	}
+}
+
+void leak_tracker::dump_at_exit() noexcept {
+	static constinit once_flag s_once;
+	call_once(s_once, []() noexcept {
+		if (std::atexit(&dump)) {
+			[[unlikely]];
+			Log::Error(evt::leak_tracker_Dump);
+		}
+	});
+}
+
+void leak_tracker::Track(_In_ const void* const key, const std::source_location& location) noexcept {
+	const std::uint64_t hash = Hash(key);
+	if (!IsSampled(hash)) {
+		return;
+	}
+	if (ResourceTable* const pTable = ResourceTable::GetInstance(); pTable) {
+		[[likely]];
+		pTable->GetShard(hash).Insert(hash, {.key = key, .location = location, .threadId = GetCurrentThreadId()});
+	}
+}
+
+void leak_tracker::Untrack(_In_ const void* const key) noexcept {
+	const std::uint64_t hash = Hash(key);
+	if (!IsSampled(hash)) {
+		return;
+	}
+	if (ResourceTable* const pTable = ResourceTable::GetInstance(); pTable) {
+		[[likely]];
+		pTable->GetShard(hash).Erase(hash, key);
+	}
+}
+
+}  // namespace m3c
@@ -0,0 +1,208 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/mapped_file.h"
+
+#include "m3c/Log.h"
+#include "m3c/exception.h"
+
+#include "m3c.events.h"
+
+#include <windows.h>
+
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace m3c {
+
+namespace {
+
+/// @brief Open a file for mapping.
+/// @param path The path of the file.
+/// @param fileMode The access mode.
+/// @return The file handle.
+[[nodiscard]] Handle OpenFile(_In_z_ const wchar_t* const path, const mapped_file::mode fileMode) {
+	const bool write = fileMode == mapped_file::mode::kReadWrite;
+	Handle file = CreateFileW(path, write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ, write ? 0 : FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (!file) {
+		[[unlikely]];
+		throw windows_error() + evt::mapped_file_Open_E;
+	}
+	return file;
+}
+
+}  // namespace
+
+//
+// mapped_view
+//
+
+mapped_view::mapped_view(_In_ void* const pBase, const std::size_t delta, const std::size_t size, const std::uint64_t offset, const bool writable) noexcept
+    : m_pBase(pBase)
+    , m_pData(static_cast<std::byte*>(pBase) + delta)
+    , m_size(size)
+    , m_offset(offset)
+    , m_writable(writable) {
+	// empty
+}
+
+mapped_view::mapped_view(mapped_view&& view) noexcept
+    : m_pBase(std::exchange(view.m_pBase, nullptr))
+    , m_pData(std::exchange(view.m_pData, nullptr))
+    , m_size(std::exchange(view.m_size, 0))
+    , m_offset(std::exchange(view.m_offset, 0))
+    , m_writable(std::exchange(view.m_writable, false)) {
+	// empty
+}
+
+mapped_view::~mapped_view() noexcept {
+	if (m_pBase) {
+		CloseSilently();
+	}
+}
+
+mapped_view& mapped_view::operator=(mapped_view&& view) noexcept {
+	if (m_pBase) {
+		CloseSilently();
+	}
+	m_pBase = std::exchange(view.m_pBase, nullptr);
+	m_pData = std::exchange(view.m_pData, nullptr);
+	m_size = std::exchange(view.m_size, 0);
+	m_offset = std::exchange(view.m_offset, 0);
+	m_writable = std::exchange(view.m_writable, false);
+	return *this;
+}
+
+std::span<std::byte> mapped_view::writable_bytes() {
+	if (m_pBase && !m_writable) {
+		[[unlikely]];
+		throw std::logic_error("mapped_view") + evt::Default;
+	}
+	return {m_pData, m_size};
+}
+
+void mapped_view::prefetch() const noexcept {
+	if (!m_size) {
+		return;
+	}
+	WIN32_MEMORY_RANGE_ENTRY range = {.VirtualAddress = m_pData, .NumberOfBytes = m_size};
+	if (!PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0)) {
+		[[unlikely]];
+		Log::Warning(evt::mapped_view_Prefetch_E, last_error());
+	}
+}
+
+void mapped_view::flush() const {
+	if (m_size && !FlushViewOfFile(m_pData, m_size)) {
+		[[unlikely]];
+		throw windows_error() + evt::mapped_view_Flush_E;
+	}
+}
+
+void mapped_view::close() {
+	if (m_pBase) {
+		if (!UnmapViewOfFile(m_pBase)) {
+			[[unlikely]];
+			throw windows_error() + evt::mapped_view_Unmap_E;
+		}
+		m_pBase = nullptr;
+		m_pData = nullptr;
+		m_size = 0;
+		m_offset = 0;
+		m_writable = false;
+	}
+}
+
+void mapped_view::CloseSilently() noexcept {
+	if (!UnmapViewOfFile(m_pBase)) {
+		[[unlikely]];
+		Log::Error(evt::mapped_view_Unmap_E, last_error());
+	}
+	m_pBase = nullptr;
+	m_pData = nullptr;
+	m_size = 0;
+	m_offset = 0;
+	m_writable = false;
+}
+
+
+//
+// mapped_file
+//
+
+mapped_file::mapped_file(_In_z_ const wchar_t* const path, const mode fileMode)
+    : mapped_file(OpenFile(path, fileMode), fileMode) {
+	// empty
+}
+
+mapped_file::mapped_file(Handle&& file, const mode fileMode)
+    : m_file(std::move(file))
+    , m_size(0)
+    , m_mode(fileMode) {
+	CreateMapping();
+}
+
+mapped_view mapped_file::map(const std::uint64_t offset, const std::size_t size) const {
+	if (offset >= m_size || !size) {
+		return {};
+	}
+
+	// views must start at a multiple of the allocation granularity
+	SYSTEM_INFO systemInfo;
+	GetSystemInfo(&systemInfo);
+	const std::uint64_t base = offset - offset % systemInfo.dwAllocationGranularity;
+	const std::size_t delta = static_cast<std::size_t>(offset - base);
+	const std::size_t length = static_cast<std::size_t>(std::min<std::uint64_t>({size, m_size - offset, SIZE_MAX - delta}));
+
+	const bool writable = m_mode == mode::kReadWrite;
+	void* const pBase = MapViewOfFile(m_mapping, writable ? FILE_MAP_WRITE : FILE_MAP_READ, static_cast<DWORD>(base >> 32u), static_cast<DWORD>(base), delta + length);
+	if (!pBase) {
+		[[unlikely]];
+		throw windows_error() + evt::mapped_file_Map_E;
+	}
+	return mapped_view(pBase, delta, length, offset, writable);
+}
+
+void mapped_file::remap(mapped_view& view, const std::uint64_t offset, const std::size_t size) const {
+	view.close();
+	view = map(offset, size);
+}
+
+void mapped_file::CreateMapping() {
+	LARGE_INTEGER fileSize;
+	if (!GetFileSizeEx(m_file, &fileSize)) {
+		[[unlikely]];
+		throw windows_error() + evt::mapped_file_Size_E;
+	}
+	m_size = static_cast<std::uint64_t>(fileSize.QuadPart);
+	if (!m_size) {
+		// CreateFileMapping fails for empty files
+		return;
+	}
+
+	const HANDLE hMapping = CreateFileMappingW(m_file, nullptr, m_mode == mode::kReadWrite ? PAGE_READWRITE : PAGE_READONLY, 0, 0, nullptr);
+	if (!hMapping) {
+		[[unlikely]];
+		throw windows_error() + evt::mapped_file_CreateMapping_E;
+	}
+	m_mapping = hMapping;
+}
+
+}  // namespace m3c
@@ -0,0 +1,45 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for COM support of the m3c library.
+module;
+
+#include <m3c/COM.h>
+#include <m3c/com_ptr.h>
+#include <m3c/ComObject.h>
+#include <m3c/ClassFactory.h>
+#include <m3c/PropVariant.h>
+
+export module m3c.com;
+
+export namespace m3c {
+
+using m3c::ClassFactory;
+using m3c::COM;
+using m3c::com_ptr;
+using m3c::ComObject;
+using m3c::make_com;
+using m3c::PropVariant;
+using m3c::Variant;
+using m3c::VariantTypeToString;
+
+using m3c::operator==;
+using m3c::operator!=;
+using m3c::operator>>;
+using m3c::swap;
+
+}  // namespace m3c
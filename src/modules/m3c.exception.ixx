@@ -0,0 +1,42 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for exceptions of the m3c library.
+/// @details `M3C_COM_HR` is a macro and still requires `#include <m3c/exception.h>`.
+module;
+
+#include <m3c/exception.h>
+
+export module m3c.exception;
+
+export namespace m3c {
+
+using m3c::com_error;
+using m3c::com_invalid_argument_error;
+using m3c::Exception;
+using m3c::rpc_error;
+using m3c::system_error;
+using m3c::windows_error;
+
+namespace evt {
+using m3c::evt::Default;
+}  // namespace evt
+
+}  // namespace m3c
+
+// Operators for adding context to exceptions which MUST be in global scope.
+export using ::operator+;
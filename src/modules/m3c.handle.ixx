@@ -0,0 +1,39 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for Windows handles of the m3c library.
+module;
+
+#include <m3c/Handle.h>
+
+export module m3c.handle;
+
+export namespace m3c {
+
+using m3c::AsyncHandle;
+using m3c::FindHandle;
+using m3c::flush_async_handles;
+using m3c::Handle;
+
+namespace internal {
+// Found by ADL for all handle types.
+using m3c::internal::operator==;
+using m3c::internal::operator!=;
+using m3c::internal::swap;
+}  // namespace internal
+
+}  // namespace m3c
@@ -0,0 +1,42 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for file I/O of the m3c library.
+module;
+
+#include <m3c/directory_iterator.h>
+#include <m3c/io_engine.h>
+#include <m3c/mapped_file.h>
+
+export module m3c.io;
+
+export import m3c.handle;
+
+export namespace m3c {
+
+using m3c::begin;
+using m3c::directory_entry;
+using m3c::directory_iterator;
+using m3c::end;
+using m3c::io_engine;
+using m3c::io_result;
+using m3c::mapped_file;
+using m3c::mapped_view;
+using m3c::walk_callback;
+using m3c::walk_directory;
+
+}  // namespace m3c
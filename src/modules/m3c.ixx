@@ -0,0 +1,30 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit which exports all modules of the m3c library.
+/// @details Macros cannot be exported from modules. `M3C_COM_HR` and `M3C_SELECT_STRING` still require the headers.
+export module m3c;
+
+export import m3c.com;
+export import m3c.exception;
+export import m3c.handle;
+export import m3c.io;
+export import m3c.log;
+export import m3c.memory;
+export import m3c.string;
+export import m3c.sync;
+export import m3c.utility;
@@ -0,0 +1,55 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for logging and formatting of the m3c library.
+/// @details The event descriptors in namespace `evt` are generated per project and still require the events header.
+module;
+
+#include <m3c/source_location.h>
+#include <m3c/format.h>
+#include <m3c/LogArgs.h>
+#include <m3c/LogData.h>
+#include <m3c/Log.h>
+
+export module m3c.log;
+
+export namespace m3c {
+
+using m3c::fmt_encode;
+using m3c::fmt_ptr;
+using m3c::hresult;
+using m3c::last_error;
+using m3c::rpc_status;
+using m3c::source_location;
+using m3c::win32_error;
+
+using m3c::Log;
+using m3c::LogArgs;
+using m3c::LogData;
+using m3c::LogEventArgs;
+using m3c::LogFormatArgs;
+using m3c::LogScope;
+using m3c::Priority;
+
+namespace log {
+using m3c::log::Print;
+}  // namespace log
+
+}  // namespace m3c
+
+// Custom log operators for windows types which MUST be in global scope.
+export using ::operator>>;
@@ -0,0 +1,45 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for smart pointers and memory management of the m3c library.
+module;
+
+#include <m3c/unique_ptr.h>
+#include <m3c/com_heap_ptr.h>
+#include <m3c/com_heap_vector.h>
+#include <m3c/leak_tracker.h>
+
+export module m3c.memory;
+
+export namespace m3c {
+
+using m3c::allocate_unique;
+using m3c::allocator_delete;
+using m3c::com_heap_ptr;
+using m3c::com_heap_vector;
+using m3c::default_delete;
+using m3c::leak_tracker;
+using m3c::make_unique;
+using m3c::make_unique_for_overwrite;
+using m3c::tracked_resource;
+using m3c::unique_ptr;
+
+using m3c::operator==;
+using m3c::operator!=;
+using m3c::swap;
+
+}  // namespace m3c
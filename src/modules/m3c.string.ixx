@@ -0,0 +1,42 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for strings and string conversion of the m3c library.
+module;
+
+#include <m3c/string_encode.h>
+#include <m3c/lazy_string.h>
+#include <m3c/rpc_string.h>
+
+export module m3c.string;
+
+export namespace m3c {
+
+using m3c::basic_lazy_string;
+using m3c::basic_rpc_string;
+using m3c::EncodeUtf16;
+using m3c::EncodeUtf8;
+using m3c::lazy_string;
+using m3c::lazy_wstring;
+using m3c::rpc_string;
+using m3c::rpc_wstring;
+
+using m3c::operator==;
+using m3c::operator!=;
+using m3c::swap;
+
+}  // namespace m3c
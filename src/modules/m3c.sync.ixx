@@ -0,0 +1,42 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for synchronization primitives of the m3c library.
+module;
+
+#include <m3c/mutex.h>
+#include <m3c/lazy.h>
+#include <m3c/mpmc_queue.h>
+#include <m3c/channel.h>
+
+export module m3c.sync;
+
+export namespace m3c {
+
+using m3c::call_once;
+using m3c::channel;
+using m3c::condition_variable;
+using m3c::lazy;
+using m3c::mpmc_queue;
+using m3c::mutex;
+using m3c::once_flag;
+using m3c::queue_lock;
+using m3c::queue_mutex;
+using m3c::scoped_lock;
+using m3c::shared_lock;
+
+}  // namespace m3c
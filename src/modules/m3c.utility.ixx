@@ -0,0 +1,58 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+/// @brief Module interface unit for type traits and small utilities of the m3c library.
+/// @details `M3C_SELECT_STRING` is a macro and still requires `#include <m3c/type_traits.h>`.
+module;
+
+#include <m3c/type_traits.h>
+#include <m3c/finally.h>
+#include <m3c/uuid_generator.h>
+
+export module m3c.utility;
+
+export namespace m3c {
+
+using m3c::contains;
+using m3c::contains_v;
+using m3c::finally;
+using m3c::index_of;
+using m3c::index_of_v;
+using m3c::is_any_of;
+using m3c::is_any_of_v;
+using m3c::is_pointer_to;
+using m3c::is_pointer_to_v;
+using m3c::is_specialization_of;
+using m3c::is_specialization_of_v;
+using m3c::is_span;
+using m3c::is_span_v;
+using m3c::is_trivially_relocatable;
+using m3c::is_trivially_relocatable_v;
+using m3c::is_unique_ptr_to;
+using m3c::is_unique_ptr_to_v;
+using m3c::type_at;
+using m3c::type_at_t;
+using m3c::type_list;
+using m3c::uuid_generator;
+
+using m3c::AnyOf;
+using m3c::PointerTo;
+using m3c::Span;
+using m3c::SpecializationOf;
+using m3c::UniquePtrTo;
+
+}  // namespace m3c
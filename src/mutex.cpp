@@ -18,12 +18,179 @@ limitations under the License.
 
 #include "m3c/mutex.h"
 
+#include "m3c/Handle.h"
+#include "m3c/Log.h"
 #include "m3c/exception.h"
 
 #include "m3c.events.h"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <new>
+#include <ratio>
+
 namespace m3c {
 
+namespace internal {
+
+/// @brief A node in the wait queue of a `queue_mutex`.
+/// @details Each node occupies its own cache line so that waiting threads do not interfere with each other.
+struct alignas(std::hardware_destructive_interference_size) QueueNode {
+	QueueNode* volatile pNext;  ///< @brief The next waiting thread.
+	volatile LONG state;        ///< @brief The state of the waiting thread, one of `kWaiting`, `kParked` or `kGranted`.
+};
+
+}  // namespace internal
+
+namespace {
+
+using internal::QueueNode;
+
+/// @brief The thread is waiting for the lock and spinning.
+constexpr LONG kWaiting = 0;
+
+/// @brief The thread is waiting for the lock and must be woken up using `WakeByAddressSingle`.
+constexpr LONG kParked = 1;
+
+/// @brief The lock has been handed over to the thread.
+constexpr LONG kGranted = 2;
+
+/// @brief The number of iterations a thread spins before it is parked.
+constexpr std::uint32_t kSpinCount = 4096;
+
+/// @brief A per-thread pool of nodes for `queue_mutex`.
+/// @details A node is in use while the thread waits for or holds a lock. Additional nodes are allocated on the heap if
+/// a thread holds more than `kNodeCount` locks at the same time.
+class QueueNodePool final {
+public:
+	/// @brief Get a node for acquiring a lock.
+	/// @details Allocates a node on the heap if the thread already holds more than `kNodeCount` locks.
+	/// @return A node for exclusive use by the current thread.
+	/// @throws std::bad_alloc if no node could be allocated.
+	[[nodiscard]] _Ret_notnull_ QueueNode* Acquire() {
+		QueueNode* const pNode = TryAcquire();
+		if (!pNode) {
+			[[unlikely]];
+			throw std::bad_alloc();
+		}
+		return pNode;
+	}
+
+	/// @brief Get a node for acquiring a lock without throwing an exception.
+	/// @details Allocates a node on the heap if the thread already holds more than `kNodeCount` locks.
+	/// @return A node for exclusive use by the current thread or `nullptr` if no node could be allocated.
+	[[nodiscard]] _Ret_maybenull_ QueueNode* TryAcquire() noexcept {
+		if (m_free) {
+			[[likely]];
+			const int index = std::countr_zero(m_free);
+			m_free &= ~(std::uint32_t(1) << index);
+			return &m_nodes[index];
+		}
+		return new (std::nothrow) QueueNode();
+	}
+
+	/// @brief Return a node after the lock has been released.
+	/// @param pNode A node which was returned by `Acquire`.
+	void Release(_In_ QueueNode* const pNode) noexcept {
+		if (pNode >= m_nodes && pNode < m_nodes + kNodeCount) {
+			[[likely]];
+			m_free |= std::uint32_t(1) << (pNode - m_nodes);
+		} else {
+			delete pNode;
+		}
+	}
+
+private:
+	static constexpr std::uint32_t kNodeCount = 8;  ///< @brief The number of nodes without allocation.
+
+	QueueNode m_nodes[kNodeCount] = {};                           ///< @brief The nodes.
+	std::uint32_t m_free = (std::uint32_t(1) << kNodeCount) - 1;  ///< @brief A bit mask of the unused nodes.
+};
+
+thread_local QueueNodePool s_queueNodePool;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+/// @brief The type of the relative due time of a waitable timer (100 ns intervals).
+using TimerDuration = std::chrono::duration<LONGLONG, std::ratio<1, 10'000'000>>;
+
+/// @brief Create a high-resolution waitable timer for the current thread.
+/// @return The timer or an invalid handle if high-resolution timers are not available.
+[[nodiscard]] Handle CreateHighResolutionTimer() noexcept {
+	const HANDLE hTimer = CreateWaitableTimerExW(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+	if (!hTimer) {
+		[[unlikely]];
+		Log::WarningOnce(evt::condition_variable_Timer_E, last_error());
+		return Handle();
+	}
+	return hTimer;
+}
+
+/// @brief Sleep until @p deadline without the granularity of the system timer.
+/// @details Uses a high-resolution waitable timer and falls back to yielding the processor if the timer is not available.
+/// @param deadline The point in time when to return.
+void SleepUntil(const std::chrono::steady_clock::time_point deadline) noexcept {
+	static thread_local const Handle s_timer = CreateHighResolutionTimer();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+	if (s_timer) {
+		[[likely]];
+		LARGE_INTEGER dueTime;
+		// negative values are relative to the current time
+		dueTime.QuadPart = -std::chrono::ceil<TimerDuration>(deadline - std::chrono::steady_clock::now()).count();
+		if (dueTime.QuadPart >= 0) {
+			return;
+		}
+		if (SetWaitableTimer(s_timer.get(), &dueTime, 0, nullptr, nullptr, FALSE) && WaitForSingleObject(s_timer.get(), INFINITE) == WAIT_OBJECT_0) {
+			[[likely]];
+			return;
+		}
+		Log::WarningOnce(evt::condition_variable_Timer_E, last_error());
+	}
+	while (std::chrono::steady_clock::now() < deadline) {
+		SwitchToThread();
+	}
+}
+
+/// @brief Wait until the condition variable is signaled or the deadline is reached.
+/// @details `SleepConditionVariableSRW` only supports timeouts in milliseconds. Whole milliseconds are waited for
+/// using the condition variable, the remainder is spent in `SleepUntil` with the lock released. A notification during
+/// this last fraction of a millisecond is not reported because the deadline has passed anyway.
+/// @param conditionVariable The condition variable.
+/// @param lock The SRW lock which MUST be held by the calling thread.
+/// @param flags Either `0` or `CONDITION_VARIABLE_LOCKMODE_SHARED`.
+/// @param deadline The point in time when to stop waiting.
+/// @return `true` if the condition was signaled, `false` if the deadline was reached.
+bool WaitUntil(CONDITION_VARIABLE& conditionVariable, SRWLOCK& lock, const ULONG flags, const std::chrono::steady_clock::time_point deadline) {
+	for (std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now(); now < deadline; now = std::chrono::steady_clock::now()) {
+		const std::chrono::steady_clock::duration remaining = deadline - now;
+		if (remaining < std::chrono::milliseconds(1)) {
+			if (flags & CONDITION_VARIABLE_LOCKMODE_SHARED) {
+				ReleaseSRWLockShared(&lock);
+				SleepUntil(deadline);
+				AcquireSRWLockShared(&lock);
+			} else {
+				ReleaseSRWLockExclusive(&lock);
+				SleepUntil(deadline);
+				AcquireSRWLockExclusive(&lock);
+			}
+			return false;
+		}
+
+		const DWORD milliseconds = deadline == std::chrono::steady_clock::time_point::max()
+		                               ? INFINITE
+		                               : static_cast<DWORD>(std::min<std::chrono::milliseconds::rep>(std::chrono::floor<std::chrono::milliseconds>(remaining).count(), INFINITE - 1));
+		if (SleepConditionVariableSRW(&conditionVariable, &lock, milliseconds, flags)) {
+			return true;
+		}
+		if (const DWORD lastError = GetLastError(); lastError != ERROR_TIMEOUT) {
+			throw windows_error(lastError) + evt::condition_variable_Wait_E;
+		}
+	}
+	return false;
+}
+
+}  // namespace
+
 //
 // mutex
 //
@@ -77,6 +244,92 @@ _Requires_shared_lock_held_(m_mutex.m_lock) _Releases_shared_lock_(m_mutex.m_loc
 }
 
 
+//
+// queue_mutex
+//
+
+void queue_mutex::lock() {
+	QueueNode* const pNode = s_queueNodePool.Acquire();
+	pNode->pNext = nullptr;
+	pNode->state = kWaiting;
+
+	QueueNode* const pPredecessor = static_cast<QueueNode*>(InterlockedExchangePointer(reinterpret_cast<void* volatile*>(&m_pTail), pNode));
+	if (pPredecessor) {
+		WritePointerRelease(reinterpret_cast<void* volatile*>(&pPredecessor->pNext), pNode);
+
+		std::uint32_t spin = 0;
+		while (ReadAcquire(&pNode->state) != kGranted) {
+			if (++spin < kSpinCount) {
+				YieldProcessor();
+				continue;
+			}
+			if (InterlockedCompareExchange(&pNode->state, kParked, kWaiting) == kGranted) {
+				break;
+			}
+			LONG parked = kParked;
+			while (ReadAcquire(&pNode->state) == kParked) {
+				WaitOnAddress(&pNode->state, &parked, sizeof(parked), INFINITE);
+			}
+		}
+	}
+	m_pOwner = pNode;
+}
+
+bool queue_mutex::try_lock() noexcept {
+	QueueNode* const pNode = s_queueNodePool.TryAcquire();
+	if (!pNode) {
+		[[unlikely]];
+		// a spurious failure is permitted for try_lock
+		return false;
+	}
+	pNode->pNext = nullptr;
+	pNode->state = kGranted;
+
+	if (InterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(&m_pTail), pNode, nullptr)) {
+		s_queueNodePool.Release(pNode);
+		return false;
+	}
+	m_pOwner = pNode;
+	return true;
+}
+
+void queue_mutex::unlock() noexcept {
+	QueueNode* const pNode = m_pOwner;
+	QueueNode* pSuccessor = static_cast<QueueNode*>(ReadPointerAcquire(reinterpret_cast<void* volatile*>(&pNode->pNext)));
+	if (!pSuccessor) {
+		if (InterlockedCompareExchangePointer(reinterpret_cast<void* volatile*>(&m_pTail), nullptr, pNode) == pNode) {
+			// no other thread is waiting
+			s_queueNodePool.Release(pNode);
+			return;
+		}
+		// another thread has already swapped the tail but not yet linked its node
+		while (!(pSuccessor = static_cast<QueueNode*>(ReadPointerAcquire(reinterpret_cast<void* volatile*>(&pNode->pNext))))) {
+			YieldProcessor();
+		}
+	}
+
+	// the successor owns the lock from now on and might free or reuse its node at any time
+	if (InterlockedExchange(&pSuccessor->state, kGranted) == kParked) {
+		WakeByAddressSingle(const_cast<LONG*>(&pSuccessor->state));  // NOLINT(cppcoreguidelines-pro-type-const-cast): API requires non-volatile pointer.
+	}
+	s_queueNodePool.Release(pNode);
+}
+
+
+//
+// queue_lock
+//
+
+queue_lock::queue_lock(queue_mutex& mtx)
+    : m_mutex(mtx) {
+	mtx.lock();
+}
+
+queue_lock::~queue_lock() noexcept {
+	m_mutex.unlock();
+}
+
+
 //
 // condition_variable
 //
@@ -93,24 +346,12 @@ void condition_variable::wait(shared_lock& lock) {
 	}
 }
 
-bool condition_variable::wait_for(scoped_lock& lock, const DWORD milliseconds) {
-	if (!SleepConditionVariableSRW(&m_conditionVariable, &lock.m_mutex.m_lock, milliseconds, 0)) {
-		if (const DWORD lastError = GetLastError(); lastError != ERROR_TIMEOUT) {
-			throw windows_error(lastError) + evt::condition_variable_Wait_E;
-		}
-		return false;
-	}
-	return true;
+bool condition_variable::wait_until(scoped_lock& lock, const std::chrono::steady_clock::time_point deadline) {
+	return WaitUntil(m_conditionVariable, lock.m_mutex.m_lock, 0, deadline);
 }
 
-bool condition_variable::wait_for(shared_lock& lock, const DWORD milliseconds) {
-	if (!SleepConditionVariableSRW(&m_conditionVariable, &lock.m_mutex.m_lock, milliseconds, CONDITION_VARIABLE_LOCKMODE_SHARED)) {
-		if (const DWORD lastError = GetLastError(); lastError != ERROR_TIMEOUT) {
-			throw windows_error(lastError) + evt::condition_variable_Wait_E;
-		}
-		return false;
-	}
-	return true;
+bool condition_variable::wait_until(shared_lock& lock, const std::chrono::steady_clock::time_point deadline) {
+	return WaitUntil(m_conditionVariable, lock.m_mutex.m_lock, CONDITION_VARIABLE_LOCKMODE_SHARED, deadline);
 }
 
 void condition_variable::notify_one() noexcept {
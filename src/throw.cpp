@@ -0,0 +1,106 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/throw.h"
+
+#include "m3c/exception.h"
+#include "m3c/source_location.h"
+
+#include <windows.h>
+#include <evntprov.h>
+#include <rpc.h>
+
+#include <utility>
+
+namespace m3c {
+
+namespace {
+
+/// @brief Throw an exception with the source location of the caller.
+/// @tparam E The type of the exception.
+/// @param exception The exception.
+/// @param sourceLocation The source location.
+template <Exception E>
+[[noreturn]] void Throw(E&& exception, const source_location& sourceLocation) {
+	throw std::forward<E>(exception) + internal::DefaultContext(evt::Default, sourceLocation);
+}
+
+/// @brief Throw an exception with the source location of the caller and a log message.
+/// @tparam E The type of the exception.
+/// @tparam M The type of the log message.
+/// @param exception The exception.
+/// @param message The log message.
+/// @param sourceLocation The source location.
+template <Exception E, internal::LogMessage M>
+[[noreturn]] void Throw(E&& exception, const M message, const source_location& sourceLocation) {
+	throw std::forward<E>(exception) + internal::ExceptionContext<M>(message, sourceLocation);
+}
+
+}  // namespace
+
+//
+// windows_error
+//
+
+void throw_windows_error(_In_range_(!=, 0) const DWORD errorCode, const source_location& sourceLocation) {
+	Throw(windows_error(errorCode), sourceLocation);
+}
+
+void throw_windows_error(_In_range_(!=, 0) const DWORD errorCode, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation) {
+	Throw<windows_error, const EVENT_DESCRIPTOR&>(windows_error(errorCode), event, sourceLocation);
+}
+
+void throw_windows_error(_In_range_(!=, 0) const DWORD errorCode, _In_z_ const char* const message, const source_location& sourceLocation) {
+	Throw<windows_error, const char*>(windows_error(errorCode), message, sourceLocation);
+}
+
+
+//
+// rpc_error
+//
+
+void throw_rpc_error(_In_range_(!=, 0) const RPC_STATUS status, const source_location& sourceLocation) {
+	Throw(rpc_error(status), sourceLocation);
+}
+
+void throw_rpc_error(_In_range_(!=, 0) const RPC_STATUS status, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation) {
+	Throw<rpc_error, const EVENT_DESCRIPTOR&>(rpc_error(status), event, sourceLocation);
+}
+
+void throw_rpc_error(_In_range_(!=, 0) const RPC_STATUS status, _In_z_ const char* const message, const source_location& sourceLocation) {
+	Throw<rpc_error, const char*>(rpc_error(status), message, sourceLocation);
+}
+
+
+//
+// com_error
+//
+
+void throw_com_error(_In_range_(<, 0) const HRESULT hr, const source_location& sourceLocation) {
+	Throw(com_error(hr), sourceLocation);
+}
+
+void throw_com_error(_In_range_(<, 0) const HRESULT hr, const EVENT_DESCRIPTOR& event, const source_location& sourceLocation) {
+	Throw<com_error, const EVENT_DESCRIPTOR&>(com_error(hr), event, sourceLocation);
+}
+
+void throw_com_error(_In_range_(<, 0) const HRESULT hr, _In_z_ const char* const message, const source_location& sourceLocation) {
+	Throw<com_error, const char*>(com_error(hr), message, sourceLocation);
+}
+
+}  // namespace m3c
@@ -0,0 +1,162 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+/// @file
+
+#include "m3c/uuid_generator.h"
+
+#include "m3c/Log.h"
+#include "m3c/format.h"
+
+#include "m3c.events.h"
+
+#include <windows.h>
+#include <bcrypt.h>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+
+namespace m3c {
+
+namespace {
+
+/// @brief The difference between the epoch of `FILETIME` (1601-01-01) and the UNIX epoch in 100 ns intervals.
+constexpr std::uint64_t kUnixEpoch = 116'444'736'000'000'000;
+
+/// @brief The number of 100 ns intervals per millisecond.
+constexpr std::uint64_t kIntervalsPerMillisecond = 10'000;
+
+/// @brief The number of bits of the counter of version 7 UUIDs.
+constexpr int kCounterBits = 12;
+
+/// @brief The mask for the 62 random bits in the lower half of a UUID.
+constexpr std::uint64_t kRandomMask = 0x3FFF'FFFF'FFFF'FFFF;
+
+/// @brief The variant bits (binary `10`) in the lower half of a UUID.
+constexpr std::uint64_t kVariant = 0x8000'0000'0000'0000;
+
+/// @brief The state of a xoshiro256** generator.
+struct RandomState final {
+	std::uint64_t s[4];  // NOLINT(cppcoreguidelines-avoid-c-arrays): State of the generator.
+	bool seeded;         ///< @brief `true` if the generator has been seeded.
+};
+
+constinit thread_local RandomState s_random = {};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+/// @brief The last timestamp and counter used for a version 7 UUID.
+constinit std::atomic<std::uint64_t> s_lastTimestamp = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared by all threads.
+
+/// @brief The splitmix64 generator for expanding a single value into a seed.
+/// @param x The state of the generator.
+/// @return The next random value.
+[[nodiscard]] std::uint64_t SplitMix64(std::uint64_t& x) noexcept {
+	std::uint64_t z = (x += 0x9E37'79B9'7F4A'7C15);
+	z = (z ^ (z >> 30)) * 0xBF58'476D'1CE4'E5B9;
+	z = (z ^ (z >> 27)) * 0x94D0'49BB'1331'11EB;
+	return z ^ (z >> 31);
+}
+
+/// @brief Seed the generator of the current thread from the operating system.
+/// @details If no random data is available, the generator is seeded from the performance counter and the thread id.
+/// @param state The state of the generator.
+void Seed(_Out_ RandomState& state) noexcept {
+	const NTSTATUS status = BCryptGenRandom(nullptr, reinterpret_cast<PUCHAR>(state.s), sizeof(state.s), BCRYPT_USE_SYSTEM_PREFERRED_RNG);
+	if (!BCRYPT_SUCCESS(status)) {
+		[[unlikely]];
+		Log::Error(evt::uuid_generator_Seed_H, hresult(HRESULT_FROM_NT(status)));
+
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+		std::uint64_t x = static_cast<std::uint64_t>(counter.QuadPart) ^ (static_cast<std::uint64_t>(GetCurrentThreadId()) << 32);
+		for (std::uint64_t& value : state.s) {
+			value = SplitMix64(x);
+		}
+	}
+	if (!(state.s[0] | state.s[1] | state.s[2] | state.s[3])) {
+		[[unlikely]];
+		// xoshiro MUST NOT be seeded with all zeros
+		state.s[0] = 1;
+	}
+	state.seeded = true;
+}
+
+/// @brief Get the next random value for the current thread.
+/// @return A random value.
+[[nodiscard]] std::uint64_t NextRandom() noexcept {
+	RandomState& state = s_random;
+	if (!state.seeded) {
+		[[unlikely]];
+		Seed(state);
+	}
+	std::uint64_t* const s = state.s;
+	const std::uint64_t result = std::rotl(s[1] * 5, 7) * 9;
+	const std::uint64_t t = s[1] << 17;
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+	s[2] ^= t;
+	s[3] = std::rotl(s[3], 45);
+	return result;
+}
+
+/// @brief Get the next timestamp and counter for a version 7 UUID.
+/// @return The milliseconds since the UNIX epoch shifted left by `kCounterBits` plus the counter.
+[[nodiscard]] std::uint64_t NextTimestamp() noexcept {
+	FILETIME ft;
+	GetSystemTimePreciseAsFileTime(&ft);
+	const std::uint64_t intervals = (static_cast<std::uint64_t>(ft.dwHighDateTime) << 32) | ft.dwLowDateTime;
+	const std::uint64_t now = ((intervals - kUnixEpoch) / kIntervalsPerMillisecond) << kCounterBits;
+
+	std::uint64_t last = s_lastTimestamp.load(std::memory_order_relaxed);
+	std::uint64_t next;  // NOLINT(cppcoreguidelines-init-variables): Set in loop.
+	do {
+		next = std::max(now, last + 1);
+	} while (!s_lastTimestamp.compare_exchange_weak(last, next, std::memory_order_relaxed));
+	return next;
+}
+
+/// @brief Create a `GUID` from two 64 bit values in the byte order of the string representation.
+/// @param high The first 8 bytes.
+/// @param low The last 8 bytes.
+/// @return A `GUID`.
+[[nodiscard]] constexpr GUID ToGuid(const std::uint64_t high, const std::uint64_t low) noexcept {
+	return {
+	    static_cast<unsigned long>(high >> 32),
+	    static_cast<unsigned short>(high >> 16),
+	    static_cast<unsigned short>(high),
+	    {static_cast<unsigned char>(low >> 56), static_cast<unsigned char>(low >> 48), static_cast<unsigned char>(low >> 40), static_cast<unsigned char>(low >> 32),
+	     static_cast<unsigned char>(low >> 24), static_cast<unsigned char>(low >> 16), static_cast<unsigned char>(low >> 8), static_cast<unsigned char>(low)}};
+}
+
+}  // namespace
+
+GUID uuid_generator::v4() noexcept {
+	const std::uint64_t high = NextRandom();
+	const std::uint64_t low = NextRandom();
+	return ToGuid((high & ~std::uint64_t(0xF000)) | 0x4000, (low & kRandomMask) | kVariant);
+}
+
+GUID uuid_generator::v7() noexcept {
+	const std::uint64_t timestamp = NextTimestamp();
+	const std::uint64_t counter = timestamp & ((std::uint64_t(1) << kCounterBits) - 1);
+	const std::uint64_t high = ((timestamp >> kCounterBits) << 16) | 0x7000 | counter;
+	return ToGuid(high, (NextRandom() & kRandomMask) | kVariant);
+}
+
+}  // namespace m3c
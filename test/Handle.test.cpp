@@ -55,6 +55,18 @@ namespace t = testing;
 // NOLINTNEXTLINE(readability-identifier-naming): De-facto constexpr.
 const HANDLE kInvalidHandleValue = INVALID_HANDLE_VALUE;  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast, performance-no-int-to-ptr): Constant definition uses cast.
 
+/// @brief A type which is not a valid strategy because `CloseSilently` may throw.
+struct ThrowingCloser {
+	static void Close(HANDLE);
+	static void CloseSilently(HANDLE);
+};
+
+static_assert(internal::CloseStrategy<internal::HandleCloser>);
+static_assert(internal::CloseStrategy<internal::FindCloser>);
+static_assert(internal::CloseStrategy<internal::AsyncHandleCloser>);
+static_assert(!internal::CloseStrategy<ThrowingCloser>);
+static_assert(!internal::CloseStrategy<int>);
+
 class Handle_Test : public t::Test {
 protected:
 	void SetUp() override {
@@ -143,6 +155,18 @@ private:
 	bool m_otherUsed = false;
 };
 
+class AsyncHandle_Test : public Handle_Test {
+protected:
+	void SetUp() override {
+		// other handles, e.g. of the thread used by AsyncHandle, MUST be set before the more specific calls
+		ON_CALL(m_win32, CloseHandle(t::_))
+		    .WillByDefault(t::Invoke([this](HANDLE hnd) {
+			    return m_win32.DTGM_Real_CloseHandle(hnd);
+		    }));
+		Handle_Test::SetUp();
+	}
+};
+
 
 //
 // Handle()
@@ -835,5 +859,55 @@ TEST_F(Handle_Test, LogException_Value_LogHandle) {
 	}
 }
 
+
+//
+// AsyncHandle
+//
+
+TEST_F(AsyncHandle_Test, dtor_Value_CloseInBackground) {
+	{
+		AsyncHandle hnd(UseFoo());
+	}
+	flush_async_handles();
+
+	EXPECT_TRUE(IsFooClosed());
+}
+
+TEST_F(AsyncHandle_Test, dtor_ValueAndErrorClosing_Log) {
+	EXPECT_CALL(m_log, Debug(DTGM_ARG2)).Times(t::AnyNumber());
+	EXPECT_CALL(m_win32, CloseHandle(t::_)).Times(t::AnyNumber());
+	{
+		AsyncHandle hnd(UseFoo());
+
+		EXPECT_CALL(m_win32, CloseHandle(GetFoo()))
+		    .WillOnce(m4t::SetLastErrorAndReturn(ERROR_INTERNAL_ERROR, FALSE))
+		    .RetiresOnSaturation();
+		EXPECT_CALL(m_log, Event(evt::HandleLeak_E.Id, DTGM_ARG3));
+	}
+	flush_async_handles();
+	EXPECT_FALSE(IsFooClosed());
+
+	// close handle manually
+	CloseHandle(GetFoo());
+	EXPECT_TRUE(IsFooClosed());
+}
+
+TEST_F(AsyncHandle_Test, close_Value_CloseImmediately) {
+	AsyncHandle hnd(UseFoo());
+	hnd.close();
+
+	EXPECT_TRUE(IsFooClosed());
+	EXPECT_EQ(kInvalidHandleValue, hnd);
+}
+
+TEST_F(AsyncHandle_Test, operatorAssign_Value_CloseInBackground) {
+	AsyncHandle hnd(UseFoo());
+	hnd = UseOther();
+	flush_async_handles();
+
+	EXPECT_TRUE(IsFooClosed());
+	EXPECT_FALSE(IsOtherClosed());
+}
+
 }  // namespace
 }  // namespace m3c::test
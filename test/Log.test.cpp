@@ -16,8 +16,11 @@ limitations under the License.
 
 #include "m3c/Log.h"
 
+#include "allocation_counter.h"
+
 #include "m3c/PropVariant.h"
 #include "m3c/exception.h"
+#include "m3c/finally.h"
 #include "m3c/source_location.h"
 
 #include <m4t/m4t.h>
@@ -36,6 +39,7 @@ limitations under the License.
 #include <cstdio>
 #include <exception>
 #include <filesystem>
+#include <limits>
 #include <new>
 #include <ostream>
 #include <stdexcept>
@@ -200,11 +204,11 @@ protected:
 	}
 
 protected:
-	std::string GetLogEventOutput(const char* const message, const char* const dynamicLogMessage, const std::source_location& loc, const std::uint32_t line) {
+	std::string GetLogEventOutput(const char* const message, const char* const dynamicLogMessage, const source_location& loc, const std::uint32_t line) {
 		return fmt::format("[{}] [{}] {}{}\n\tat {}({}) ({})\n", GetLevelOutput(), GetCurrentThreadId(), message, dynamicLogMessage, loc.file_name(), line, loc.function_name());
 	}
 
-	static std::string GetExceptionOutput(const char* const message, const std::source_location& loc, const std::uint32_t line) {
+	static std::string GetExceptionOutput(const char* const message, const source_location& loc, const std::uint32_t line) {
 		return fmt::format(fmt::runtime(std::string("\tcaused by: {}\n") + (line ? "\t\tat {}({}) ({})\n" : "")), message, loc.file_name(), line, loc.function_name());
 	}
 
@@ -257,29 +261,29 @@ protected:
 		std::uint32_t exceptionLine = 0;
 		std::uint32_t innerExceptionLine = 0;
 		std::uint32_t line = 0;
-		std::source_location exceptionLocation;
-		std::source_location innerExceptionLocation;
-		std::source_location location;
+		source_location exceptionLocation;
+		source_location innerExceptionLocation;
+		source_location location;
 		HRESULT hr = S_OK;
 
 		if constexpr (!kException) {
 			m4t::WithLocale("en-US", [eventType, level = GetLevel(), &line, &location] {
 				switch (eventType) {
 				case EventType::kEvent:
-					line = (location = std::source_location::current()).line() + 1;
+					line = (location = source_location::current()).line() + 1;
 					Log::Message(level, evt::Test_Event_String, "mymessage");
 					break;
 				case EventType::kCharPtr:
-					line = (location = std::source_location::current()).line() + 1;
+					line = (location = source_location::current()).line() + 1;
 					Log::Message(level, "zstring event with string {}", "mymessage");
 					break;
 				case EventType::kString:
-					line = (location = std::source_location::current()).line() + 1;
+					line = (location = source_location::current()).line() + 1;
 					Log::Message(level, std::string("string event with string {}"), "mymessage");
 					break;
 				case EventType::kStringRef: {
 					const std::string str = "string& event with string {}";
-					line = (location = std::source_location::current()).line() + 1;
+					line = (location = source_location::current()).line() + 1;
 					Log::Message(level, str, "mymessage");
 					break;
 				}
@@ -301,14 +305,14 @@ protected:
 					}
 				} else {
 					if constexpr (!kNested) {
-						exceptionLine = (exceptionLocation = std::source_location::current()).line() + 1;
+						exceptionLine = (exceptionLocation = source_location::current()).line() + 1;
 						throw((std::forward<E>(exception) + detail) << ... << std::forward<Args>(args));
 					} else {
 						try {
-							innerExceptionLine = (innerExceptionLocation = std::source_location::current()).line() + 1;
+							innerExceptionLine = (innerExceptionLocation = source_location::current()).line() + 1;
 							throw std::exception("inner cause") + evt::Default;
 						} catch (...) {
-							exceptionLine = (exceptionLocation = std::source_location::current()).line() + 1;
+							exceptionLine = (exceptionLocation = source_location::current()).line() + 1;
 							std::throw_with_nested(((std::forward<E>(exception) + detail) << ... << std::forward<Args>(args)));
 						}
 					}
@@ -318,20 +322,20 @@ protected:
 					m4t::WithLocale("en-US", [eventType, level = GetLevel(), &line, &location] {
 						switch (eventType) {
 						case EventType::kEvent:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							Log::Exception(level, evt::Test_Event_String, "mymessage");
 							break;
 						case EventType::kCharPtr:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							Log::Exception(level, "zstring event with string {}", "mymessage");
 							break;
 						case EventType::kString:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							Log::Exception(level, "string event with string {}", "mymessage");
 							break;
 						case EventType::kStringRef: {
 							const std::string str = "string& event with string {}";
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							Log::Exception(level, str, "mymessage");
 							break;
 						}
@@ -343,20 +347,20 @@ protected:
 					m4t::WithLocale("en-US", [eventType, level = GetLevel(), &line, &location, &hr] {
 						switch (eventType) {
 						case EventType::kEvent:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							hr = Log::ExceptionToHResult(level, evt::Test_Event_String_H, "mymessage");
 							break;
 						case EventType::kCharPtr:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							hr = Log::ExceptionToHResult(level, "zstring event with string {} and error: {}", "mymessage");
 							break;
 						case EventType::kString:
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							hr = Log::ExceptionToHResult(level, "string event with string {} and error: {}", "mymessage");
 							break;
 						case EventType::kStringRef: {
 							const std::string str = "string& event with string {} and error: {}";
-							line = (location = std::source_location::current()).line() + 1;
+							line = (location = source_location::current()).line() + 1;
 							hr = Log::ExceptionToHResult(level, str, "mymessage");
 							break;
 						}
@@ -648,6 +652,234 @@ TEST_F(LogString_Test, TraceHResult_HRESULT_Print) {
 	}
 }
 
+
+//
+// LogScope
+//
+
+TEST_F(LogString_Test, LogScope_EndsWithoutError_Discard) {
+	{
+		LogScope scope;
+		Log::Trace(evt::Test_Event_String, "mymessage");
+	}
+	Log::Critical("after scope");
+
+	if constexpr (kMinimumLevel < Priority::kTrace && kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Critical\\] \\[\\d+\\] after scope\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, LogScope_Flush_Print) {
+	{
+		LogScope scope;
+		Log::Trace(evt::Test_Event_String, "mymessage");
+		scope.Flush();
+	}
+
+	if constexpr (kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Trace\\] \\[\\d+\\] Testing event with string mymessage\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, LogScope_ErrorLogged_PrintBufferFirst) {
+	{
+		LogScope scope;
+		Log::Trace(evt::Test_Event_String, "mymessage");
+		Log::Error("failed");
+	}
+
+	if constexpr (kOutputPrint && kMinimumLevel >= Priority::kError) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Trace\\] \\[\\d+\\] Testing event with string mymessage\n\tat.*\n\\[Error\\] \\[\\d+\\] failed\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, LogScope_LeftByException_Print) {
+	try {
+		LogScope scope;
+		Log::Trace(evt::Test_Event_String, "mymessage");
+		throw std::exception("error");
+	} catch (const std::exception&) {
+		// ignore
+	}
+
+	if constexpr (kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Trace\\] \\[\\d+\\] Testing event with string mymessage\n\tat.*\n"));
+	}
+}
+
+
+//
+// SetSampleRate
+//
+
+/// @brief Run @p test with sample rate 2 and @p activityId set for the current thread.
+template <typename T>
+void WithSampledActivity(GUID activityId, T&& test) {
+	ASSERT_EQ(static_cast<ULONG>(ERROR_SUCCESS), EventActivityIdControl(EVENT_ACTIVITY_CTRL_GET_SET_ID, &activityId));
+	const auto reset = finally([&activityId]() noexcept {
+		EventActivityIdControl(EVENT_ACTIVITY_CTRL_SET_ID, &activityId);
+		Log::SetSampleRate(1);
+	});
+	Log::SetSampleRate(2);
+	test();
+}
+
+TEST_F(LogString_Test, SetSampleRate_ActivityIsSampled_Print) {
+	WithSampledActivity({2, 0, 0, {0}}, [] {
+		Log::Verbose("sampled");
+	});
+
+	if constexpr (kMinimumLevel >= Priority::kVerbose && kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Verbose\\] \\[\\d+\\] sampled\n\tat.*\n"));
+	} else {
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+TEST_F(LogString_Test, SetSampleRate_ActivityIsNotSampled_Drop) {
+	WithSampledActivity({1, 0, 0, {0}}, [] {
+		Log::Verbose("sampled");
+	});
+
+	EXPECT_EQ("", m_debug);
+}
+
+TEST_F(LogString_Test, SetSampleRate_ActivityIsNotSampled_PrintInfo) {
+	WithSampledActivity({1, 0, 0, {0}}, [] {
+		Log::Info("not sampled");
+	});
+
+	if constexpr (kMinimumLevel >= Priority::kInfo && kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Info(?:rmation)?\\] \\[\\d+\\] not sampled\n\tat.*\n"));
+	} else {
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+TEST_F(LogString_Test, SetSampleRate_RateTooLarge_PrintOutsideOfActivity) {
+	const auto reset = finally([]() noexcept {
+		Log::SetSampleRate(1);
+	});
+	Log::SetSampleRate(std::numeric_limits<std::uint32_t>::max());
+
+	Log::Verbose("no activity");
+
+	if constexpr (kMinimumLevel >= Priority::kVerbose && kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Verbose\\] \\[\\d+\\] no activity\n\tat.*\n"));
+	} else {
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+
+//
+// Call sites
+//
+
+TEST_F(LogString_Test, EnableFile_FileMatches_Print) {
+	const auto reset = finally([]() noexcept {
+		Log::DisableSites();
+	});
+	Log::EnableFile("*log.TEST.cpp");
+
+	Log::Trace("enabled");
+
+	if constexpr (kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Trace\\] \\[\\d+\\] enabled\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, EnableFile_FileDoesNotMatch_Drop) {
+	const auto reset = finally([]() noexcept {
+		Log::DisableSites();
+	});
+	Log::EnableFile("*other.test.cpp");
+
+	Log::Trace("disabled");
+
+	if constexpr (kMinimumLevel < Priority::kTrace) {
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+TEST_F(LogString_Test, EnableFunction_FunctionMatches_Print) {
+	const auto reset = finally([]() noexcept {
+		Log::DisableSites();
+	});
+	Log::EnableFunction("*EnableFunction_FunctionMatches_Print*", Priority::kDebug);
+
+	Log::Debug("enabled");
+
+	if constexpr (kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Debug\\] \\[\\d+\\] enabled\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, EnableLines_LineInRange_Print) {
+	const auto reset = finally([]() noexcept {
+		Log::DisableSites();
+	});
+	constexpr std::uint_least32_t kLine = __LINE__ + 3;
+	Log::EnableLines("*Log.test.cpp", kLine, kLine);
+
+	Log::Trace("enabled");
+	Log::Trace("disabled");
+
+	if constexpr (kMinimumLevel < Priority::kTrace && kOutputPrint) {
+		EXPECT_THAT(m_debug, m4t::MatchesRegex("\\[Trace\\] \\[\\d+\\] enabled\n\tat.*\n"));
+	}
+}
+
+TEST_F(LogString_Test, DisableSites_SiteWasEnabled_Drop) {
+	const auto log = []() noexcept {
+		Log::Trace("disabled");
+	};
+	Log::EnableFile("*Log.test.cpp");
+	log();
+	m_debug.clear();
+	Log::DisableSites();
+
+	log();
+
+	if constexpr (kMinimumLevel < Priority::kTrace) {
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+
+//
+// Allocations
+//
+
+TEST_F(LogString_Test, LogScope_BelowLevel_BufferWithoutAllocations) {
+	if constexpr (kMinimumLevel < Priority::kTrace) {
+		const LogScope scope;
+		// the buffer of the thread is created on first use
+		Log::Trace(evt::Test_Event_String, "first");
+
+		// wraps around in the buffer
+		EXPECT_NO_ALLOCATIONS({
+			for (std::uint32_t i = 0; i < 100; ++i) {
+				Log::Trace(evt::Test_Event_String, "mymessage");
+			}
+		});
+		EXPECT_EQ("", m_debug);
+	}
+}
+
+#endif
+
+#if M3C_LOG_OUTPUT_EVENT && !M3C_LOG_OUTPUT_PRINT
+
+// not using Log_Test because calls of the mocked functions allocate
+TEST(Log_Allocations_Test, Debug_Event_NoAllocations) {
+	if constexpr (Priority::kDebug <= kMinimumLevel) {
+		EXPECT_NO_ALLOCATIONS(Log::Debug(evt::Test_Event_String, "mymessage"));
+		EXPECT_NO_ALLOCATIONS(Log::Debug(evt::Test_Event_Int, 7));
+		EXPECT_NO_ALLOCATIONS(Log::Debug(evt::Test_FormatWidth, 1, 2, 3, L"wide"));
+	}
+}
+
 #endif
 
 //
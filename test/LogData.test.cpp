@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "m3c/LogData.h"
 
+#include "allocation_counter.h"
+
 #include "m3c/Log.h"
 #include "m3c/finally.h"
 
@@ -36,11 +38,13 @@ limitations under the License.
 #include <wtypes.h>
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
 #include <limits>
+#include <numeric>
 #include <span>
 #include <string>
 #include <string_view>
@@ -190,12 +194,35 @@ public:
 	[[nodiscard]] CustomTypeThrowConstructible(CustomTypeThrowConstructible&&) noexcept(false) = default;
 };
 
+class CustomTypeRelocatable : public CustomTypeMoveable {
+public:
+	using CustomTypeMoveable::CustomTypeMoveable;
+	[[nodiscard]] CustomTypeRelocatable(const CustomTypeRelocatable&) noexcept = default;
+	[[nodiscard]] CustomTypeRelocatable(CustomTypeRelocatable&&) noexcept = default;
+};
+
+}  // namespace
+}  // namespace m3c::test
+
+template <>
+struct m3c::is_trivially_relocatable<m3c::test::CustomTypeRelocatable> : std::true_type {
+	// empty
+};
+
+namespace m3c::test {
+namespace {
+
 static_assert(std::is_trivially_copyable_v<CustomTypeTrivial>);
 static_assert(std::is_trivially_copyable_v<CustomTypeTrivialEventData>);
 static_assert(!std::is_trivially_copyable_v<CustomTypeMoveable>);
 static_assert(!std::is_trivially_copyable_v<CustomTypeMoveableEventData>);
 static_assert(!std::is_trivially_copyable_v<CustomTypeNonMoveable>);
 static_assert(!std::is_trivially_copyable_v<CustomTypeThrowConstructible>);
+static_assert(!std::is_trivially_copyable_v<CustomTypeRelocatable>);
+
+static_assert(is_trivially_relocatable_v<CustomTypeTrivial>);
+static_assert(!is_trivially_relocatable_v<CustomTypeMoveable>);
+static_assert(is_trivially_relocatable_v<CustomTypeRelocatable>);
 
 static_assert(std::is_nothrow_copy_constructible_v<CustomTypeMoveable>);
 static_assert(std::is_nothrow_copy_constructible_v<CustomTypeMoveableEventData>);
@@ -237,6 +264,15 @@ template <>
 struct fmt::formatter<m3c::test::CustomTypeMoveableEventData> : public fmt::formatter<m3c::test::CustomTypeMoveable> {
 };
 
+template <>
+struct fmt::formatter<m3c::test::CustomTypeRelocatable> : public fmt::formatter<std::string> {
+public:
+	template <typename FormatContext>
+	[[nodiscard]] auto format(const m3c::test::CustomTypeRelocatable& arg, FormatContext& ctx) const -> decltype(ctx.out()) {
+		return __super::format(fmt::format("(CustomTypeRelocatable: {}, copy #{}, move #{})", arg.GetValue(), arg.GetCopies(), arg.GetMoves()), ctx);
+	}
+};
+
 template <>
 struct fmt::formatter<m3c::test::CustomTypeNonMoveable> : public fmt::formatter<std::string> {
 public:
@@ -1319,6 +1355,99 @@ TEST_F(LogData_Test, CopyMove_CustomMoveable_PrintData) {
 	EXPECT_EQ(tracking.created, tracking.deleted);
 }
 
+TEST_F(LogData_Test, CopyMove_CustomRelocatable_MoveWithMemcpy) {
+	Tracking tracking;
+
+	{
+		LogData source;
+		source << CustomTypeRelocatable(234, tracking);
+		EXPECT_EQ(2, tracking.created);
+		EXPECT_EQ(1, tracking.deleted);
+
+		LogData move(std::move(source));
+		LogData moveAssign;
+		moveAssign = std::move(move);
+
+		// moving neither constructs nor destructs
+		EXPECT_EQ(2, tracking.created);
+		EXPECT_EQ(1, tracking.deleted);
+
+		const LogData copy(moveAssign);
+		EXPECT_EQ(3, tracking.created);
+
+		LogFormatArgs args;
+		moveAssign.CopyArgumentsTo(args);
+		EXPECT_EQ("(CustomTypeRelocatable: 234, copy #0, move #1)", fmt::vformat("{}", *args));
+
+		LogFormatArgs copyArgs;
+		copy.CopyArgumentsTo(copyArgs);
+		EXPECT_EQ("(CustomTypeRelocatable: 234, copy #1, move #1)", fmt::vformat("{}", *copyArgs));
+	}
+	EXPECT_EQ(3, tracking.created);
+	EXPECT_EQ(tracking.created, tracking.deleted);
+}
+
+TEST_F(LogData_Test, Grow_CustomRelocatable_MoveWithMemcpy) {
+	const std::string text(M3C_LOGDATA_SIZE * 2, 'x');
+	const std::string longText(M3C_LOGDATA_SIZE * 16, 'y');
+	Tracking tracking;
+
+	{
+		LogData logData;
+		logData << CustomTypeRelocatable(234, tracking) << CustomTypeRelocatable(345, tracking);
+		EXPECT_EQ(4, tracking.created);
+		EXPECT_EQ(2, tracking.deleted);
+
+		// move from stack to heap and then to a larger heap buffer
+		logData << text;
+		logData << longText;
+
+		// growing neither constructs nor destructs
+		EXPECT_EQ(4, tracking.created);
+		EXPECT_EQ(2, tracking.deleted);
+
+		LogFormatArgs args;
+		logData.CopyArgumentsTo(args);
+		EXPECT_EQ(fmt::format("(CustomTypeRelocatable: 234, copy #0, move #1) (CustomTypeRelocatable: 345, copy #0, move #1) {} {}", text, longText),
+		          fmt::vformat("{} {} {} {}", *args));
+	}
+	EXPECT_EQ(4, tracking.created);
+	EXPECT_EQ(tracking.created, tracking.deleted);
+}
+
+TEST_F(LogData_Test, Grow_CustomRelocatableAndMoveable_MoveObjects) {
+	const std::string text(M3C_LOGDATA_SIZE * 2, 'x');
+	const std::string longText(M3C_LOGDATA_SIZE * 16, 'y');
+	Tracking tracking;
+
+	{
+		LogData logData;
+		logData << CustomTypeRelocatable(234, tracking) << CustomTypeMoveable(345, tracking);
+		EXPECT_EQ(4, tracking.created);
+		EXPECT_EQ(2, tracking.deleted);
+
+		// move from stack to heap
+		logData << text;
+
+		// one argument is not relocatable, so all objects are moved
+		EXPECT_EQ(6, tracking.created);
+		EXPECT_EQ(4, tracking.deleted);
+
+		// move to a larger heap buffer
+		logData << longText;
+
+		EXPECT_EQ(8, tracking.created);
+		EXPECT_EQ(6, tracking.deleted);
+
+		LogFormatArgs args;
+		logData.CopyArgumentsTo(args);
+		EXPECT_EQ(fmt::format("(CustomTypeRelocatable: 234, copy #0, move #3) (CustomTypeMoveable: 345, copy #0, move #3) {} {}", text, longText),
+		          fmt::vformat("{} {} {} {}", *args));
+	}
+	EXPECT_EQ(8, tracking.created);
+	EXPECT_EQ(tracking.created, tracking.deleted);
+}
+
 TEST_F(LogData_Test, CopyArgumentsTo_CustomNonMoveable_PrintData) {
 	Tracking tracking;
 
@@ -1779,5 +1908,89 @@ TEST_F(LogData_Test, CopyArgumentsTo_WICRect_PrintTopLeftWidthHeight) {
 	}
 }
 
+
+//
+// Allocations
+//
+
+TEST_F(LogData_Test, Allocations_InlineArguments_NoAllocations) {
+	constexpr GUID kGuid = {0x1e3a9b5c, 0x0f4d, 0x4c2e, {0x9a, 0x8b, 0x7c, 0x6d, 0x5e, 0x4f, 0x3a, 0x2b}};
+	LogData logData;
+
+	EXPECT_NO_ALLOCATIONS(logData << 7 << 'a' << 1.5 << "text" << L"wide" << kGuid << hresult(E_INVALIDARG));
+
+	EXPECT_NO_ALLOCATIONS({
+		LogData copy(logData);
+		LogData move(std::move(copy));
+		LogData assign;
+		assign = move;
+		assign = std::move(move);
+	});
+}
+
+TEST_F(LogData_Test, Allocations_ExceedStackBuffer_AllocateHeapBufferOnce) {
+	const std::string text(M3C_LOGDATA_SIZE * 2, 'x');
+	LogData logData;
+
+	EXPECT_ALLOCATIONS(1, logData << text);
+
+	// the heap buffer is shared
+	EXPECT_NO_ALLOCATIONS({
+		LogData copy(logData);
+		LogData move(std::move(copy));
+	});
+}
+
+TEST_F(LogData_Test, Allocations_LogFormatArgsExceedInlineSize_DoubleCapacity) {
+	std::array<int, M3C_LOGARGS_SIZE * 2 + 1> values;
+	std::iota(values.begin(), values.end(), 1);
+	LogFormatArgs args;
+
+	EXPECT_NO_ALLOCATIONS({
+		for (std::size_t i = 0; i < M3C_LOGARGS_SIZE; ++i) {
+			args << values[i];
+		}
+	});
+	EXPECT_ALLOCATIONS(1, {
+		for (std::size_t i = M3C_LOGARGS_SIZE; i < M3C_LOGARGS_SIZE * 2; ++i) {
+			args << values[i];
+		}
+	});
+	EXPECT_ALLOCATIONS(1, args << values.back());
+
+	ASSERT_EQ(values.size(), args.size());
+	std::string pattern;
+	std::string expected;
+	for (const int value : values) {
+		pattern += "{} ";
+		expected += fmt::format("{} ", value);
+	}
+	EXPECT_EQ(expected, fmt::vformat(pattern, *args));
+}
+
+TEST_F(LogData_Test, Allocations_LogEventArgsExceedInlineSize_DoubleCapacity) {
+	std::array<int, M3C_LOGARGS_SIZE * 2 + 1> values;
+	std::iota(values.begin(), values.end(), 1);
+	LogEventArgs args;
+
+	EXPECT_NO_ALLOCATIONS({
+		for (std::size_t i = 0; i < M3C_LOGARGS_SIZE; ++i) {
+			args << values[i];
+		}
+	});
+	EXPECT_ALLOCATIONS(1, {
+		for (std::size_t i = M3C_LOGARGS_SIZE; i < M3C_LOGARGS_SIZE * 2; ++i) {
+			args << values[i];
+		}
+	});
+	EXPECT_ALLOCATIONS(1, args << values.back());
+
+	ASSERT_EQ(values.size(), args.size());
+	for (std::size_t i = 0; i < values.size(); ++i) {
+		EXPECT_EQ(sizeof(int), args[i].Size);
+		EXPECT_EQ(values[i], *reinterpret_cast<const int*>(args[i].Ptr));  // NOLINT(performance-no-int-to-ptr): Must use existing API.
+	}
+}
+
 }  // namespace
 }  // namespace m3c::test
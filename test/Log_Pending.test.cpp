@@ -0,0 +1,147 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/Log.h"
+
+#include "m3c/Handle.h"
+#include "m3c/finally.h"
+
+#include "test.events.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <windows.h>
+#include <detours_gmock.h>
+#include <evntprov.h>
+
+#include <cstdint>
+#include <vector>
+
+// The tests in this file require that the logger is created in the first test, so main MUST NOT use the logger.
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+#undef WIN32_FUNCTIONS
+#define WIN32_FUNCTIONS(fn_)                                                                                                                                                                         \
+	fn_(4, ULONG, __stdcall, EventRegister,                                                                                                                                                          \
+	    (LPCGUID ProviderId, PENABLECALLBACK EnableCallback, PVOID CallbackContext, PREGHANDLE RegHandle),                                                                                           \
+	    (ProviderId, EnableCallback, CallbackContext, RegHandle),                                                                                                                                    \
+	    nullptr);                                                                                                                                                                                    \
+	fn_(8, ULONG, __stdcall, EventWriteEx,                                                                                                                                                           \
+	    (REGHANDLE RegHandle, PCEVENT_DESCRIPTOR EventDescriptor, ULONG64 Filter, ULONG Flags, LPCGUID ActivityId, LPCGUID RelatedActivityId, ULONG UserDataCount, PEVENT_DATA_DESCRIPTOR UserData), \
+	    (RegHandle, EventDescriptor, Filter, Flags, ActivityId, RelatedActivityId, UserDataCount, UserData),                                                                                         \
+	    nullptr)
+
+/// @brief The capacity of the queue for events logged during registration.
+constexpr std::uint32_t kQueueCapacity = 16;
+
+/// @brief The activity id used for logging.
+constexpr GUID kActivityId = {0x6F1C2A3B, 0x4D5E, 0x4F60, {0x81, 0x92, 0xA3, 0xB4, 0xC5, 0xD6, 0xE7, 0xF8}};
+
+/// @brief The data of an event passed to `EventWriteEx`.
+struct WrittenEvent final {
+	USHORT id;                  ///< @brief The event id.
+	bool hasActivityId;         ///< @brief `true` if an activity id has been passed.
+	GUID activityId;            ///< @brief The activity id if @p hasActivityId is `true`.
+	std::vector<ULONG> values;  ///< @brief The first four bytes of each argument.
+};
+
+class Log_Pending_Test : public t::Test {
+protected:
+	void SetUp() override {
+		ON_CALL(m_win32, EventWriteEx)
+		    .WillByDefault(t::Invoke([this](REGHANDLE /* RegHandle */, PCEVENT_DESCRIPTOR EventDescriptor, ULONG64 /* Filter */, ULONG /* Flags */, LPCGUID ActivityId, LPCGUID /* RelatedActivityId */, ULONG UserDataCount, PEVENT_DATA_DESCRIPTOR UserData) {
+			    WrittenEvent& event = m_events.emplace_back(WrittenEvent{.id = EventDescriptor->Id, .hasActivityId = ActivityId != nullptr, .activityId = ActivityId ? *ActivityId : GUID{}, .values = {}});
+			    for (ULONG i = 0; i < UserDataCount; ++i) {
+				    event.values.push_back(UserData[i].Size >= sizeof(ULONG) ? *reinterpret_cast<const ULONG*>(static_cast<ULONG_PTR>(UserData[i].Ptr)) : 0);
+			    }
+			    return static_cast<ULONG>(ERROR_SUCCESS);
+		    }));
+		EXPECT_CALL(m_win32, EventWriteEx).Times(t::AnyNumber());
+	}
+
+protected:
+	DTGM_API_MOCK(m_win32, WIN32_FUNCTIONS);
+	std::vector<WrittenEvent> m_events;
+};
+
+TEST_F(Log_Pending_Test, LogBeforeRegistration_WriteQueuedInOrderAndWarnDropped) {
+	const Handle registration = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	ASSERT_TRUE(registration);
+
+	// block the registration until all events have been logged
+	EXPECT_CALL(m_win32, EventRegister(t::Pointee(Test_Provider), DTGM_ARG3))
+	    .WillOnce(t::Invoke([this, &registration](LPCGUID ProviderId, PENABLECALLBACK EnableCallback, PVOID CallbackContext, PREGHANDLE RegHandle) {
+		    WaitForSingleObject(registration, INFINITE);
+		    return m_win32.DTGM_Real_EventRegister(ProviderId, EnableCallback, CallbackContext, RegHandle);
+	    }));
+
+	{
+		GUID activityId = kActivityId;
+		ASSERT_EQ(static_cast<ULONG>(ERROR_SUCCESS), EventActivityIdControl(EVENT_ACTIVITY_CTRL_GET_SET_ID, &activityId));
+		const auto reset = finally([&activityId]() noexcept {
+			EventActivityIdControl(EVENT_ACTIVITY_CTRL_SET_ID, &activityId);
+		});
+
+		for (std::uint32_t i = 0; i < kQueueCapacity + 2; ++i) {
+			Log::Info(evt::Test_Event_Int, static_cast<int>(i));
+		}
+	}
+
+	// nothing is written before the registration has completed
+	EXPECT_THAT(m_events, t::IsEmpty());
+
+	ASSERT_TRUE(SetEvent(registration));
+	Log::WaitForRegistration();
+
+	ASSERT_EQ(kQueueCapacity + 1, m_events.size());
+	for (std::uint32_t i = 0; i < kQueueCapacity; ++i) {
+		const WrittenEvent& event = m_events[i];
+		EXPECT_EQ(evt::Test_Event_Int.Id, event.id);
+		ASSERT_THAT(event.values, t::Not(t::IsEmpty()));
+		EXPECT_EQ(i, event.values[0]);
+		EXPECT_TRUE(event.hasActivityId);
+		EXPECT_EQ(kActivityId, event.activityId);
+	}
+
+	const WrittenEvent& warning = m_events[kQueueCapacity];
+	EXPECT_EQ(evt::Log_PendingDropped.Id, warning.id);
+	ASSERT_LE(2, warning.values.size());
+	EXPECT_EQ(2, warning.values[0]);
+	EXPECT_EQ(kQueueCapacity, warning.values[1]);
+}
+
+TEST_F(Log_Pending_Test, LogAfterRegistration_WriteImmediately) {
+	// the logger has been registered by the previous test
+	EXPECT_CALL(m_win32, EventRegister).Times(0);
+	Log::WaitForRegistration();
+
+	Log::Info(evt::Test_Event_Int, 7);
+
+	ASSERT_EQ(1, m_events.size());
+	EXPECT_EQ(evt::Test_Event_Int.Id, m_events[0].id);
+	ASSERT_THAT(m_events[0].values, t::Not(t::IsEmpty()));
+	EXPECT_EQ(7, m_events[0].values[0]);
+	// the activity id of the current thread is used
+	EXPECT_FALSE(m_events[0].hasActivityId);
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -0,0 +1,108 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "allocation_counter.h"
+
+#include "m3c/lazy.h"
+
+#include <crtdbg.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace m3c::test {
+namespace {
+
+/// @brief The number of allocations of the current thread.
+constinit thread_local std::uint64_t s_allocations = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+/// @brief `true` while `operator new` calls `malloc` to prevent counting the allocation twice.
+constinit thread_local bool s_inOperatorNew = false;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Thread local variable.
+
+#if _DEBUG
+/// @brief Guards the installation of the allocation hook.
+constinit once_flag s_hookInstalled;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Shared by all threads.
+
+/// @brief The allocation hook which was active before installing `AllocationHook`.
+constinit _CRT_ALLOC_HOOK s_previousHook = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Set once.
+
+/// @brief Count allocations using `malloc` and `realloc` of the debug heap.
+/// @return The result of the previous hook or `TRUE` to allow the operation.
+int __cdecl AllocationHook(const int allocType, void* const userData, const std::size_t size, const int blockType, const long requestNumber, const unsigned char* const filename, const int lineNumber) {
+	if ((allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC) && blockType != _CRT_BLOCK && !s_inOperatorNew) {
+		++s_allocations;
+	}
+	return s_previousHook ? s_previousHook(allocType, userData, size, blockType, requestNumber, filename, lineNumber) : TRUE;
+}
+#endif
+
+/// @brief Count an allocation and allocate memory like the default `operator new`.
+/// @tparam F The type of the allocation function.
+/// @param allocate The function which allocates the memory.
+/// @return The allocated memory.
+template <typename F>
+[[nodiscard]] void* Allocate(F&& allocate) {
+	++s_allocations;
+	while (true) {
+		s_inOperatorNew = true;
+		void* const ptr = allocate();
+		s_inOperatorNew = false;
+		if (ptr) {
+			[[likely]];
+			return ptr;
+		}
+		const std::new_handler handler = std::get_new_handler();
+		if (!handler) {
+			throw std::bad_alloc();
+		}
+		handler();
+	}
+}
+
+}  // namespace
+
+allocation_counter::allocation_counter() noexcept
+    : m_start(s_allocations) {
+#if _DEBUG
+	call_once(s_hookInstalled, []() noexcept {
+		s_previousHook = _CrtSetAllocHook(AllocationHook);
+	});
+#endif
+}
+
+std::uint64_t allocation_counter::count() const noexcept {
+	return s_allocations - m_start;
+}
+
+}  // namespace m3c::test
+
+
+// The other forms of operator new and all forms of operator delete forward to these functions or use free and
+// _aligned_free respectively, i.e. replacing the two functions is sufficient.
+
+void* operator new(const std::size_t size) {
+	return m3c::test::Allocate([size]() noexcept {
+		return std::malloc(size ? size : 1);
+	});
+}
+
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+	return m3c::test::Allocate([size, alignment]() noexcept {
+		return _aligned_malloc(size ? size : 1, static_cast<std::size_t>(alignment));
+	});
+}
@@ -0,0 +1,64 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+namespace m3c::test {
+
+/// @brief Counts the allocations of the current thread during the lifetime of the object.
+/// @details All allocations using the global `operator new` are counted. In debug builds, allocations using `malloc`
+/// and `realloc` are counted as well. Allocations of other threads are never counted.
+class allocation_counter final {
+public:
+	/// @brief Start counting.
+	[[nodiscard]] allocation_counter() noexcept;
+
+	allocation_counter(const allocation_counter&) = delete;
+	allocation_counter(allocation_counter&&) = delete;
+	~allocation_counter() noexcept = default;
+
+public:
+	allocation_counter& operator=(const allocation_counter&) = delete;
+	allocation_counter& operator=(allocation_counter&&) = delete;
+
+public:
+	/// @brief Get the number of allocations since the object was created.
+	/// @return The number of allocations of the current thread.
+	[[nodiscard]] std::uint64_t count() const noexcept;
+
+private:
+	std::uint64_t m_start;  ///< @brief The number of allocations of the current thread when the object was created.
+};
+
+}  // namespace m3c::test
+
+/// @brief Expect that running the statements allocates exactly @p count_ times.
+/// @param count_ The expected number of allocations.
+/// @param ... The statements.
+#define EXPECT_ALLOCATIONS(count_, ...)                                                                      \
+	do {                                                                                                     \
+		const m3c::test::allocation_counter allocationCounter_;                                              \
+		__VA_ARGS__;                                                                                         \
+		EXPECT_EQ(static_cast<std::uint64_t>(count_), allocationCounter_.count()) << "in: " << #__VA_ARGS__; \
+	} while (false)
+
+/// @brief Expect that running the statements does not allocate.
+/// @param ... The statements.
+#define EXPECT_NO_ALLOCATIONS(...) EXPECT_ALLOCATIONS(0, __VA_ARGS__)
@@ -0,0 +1,93 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "allocation_counter.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <memory>
+#include <new>
+
+namespace m3c::test {
+namespace {
+
+//
+// allocation_counter
+//
+
+TEST(allocation_counter_Test, count_NoAllocation_ReturnZero) {
+	const allocation_counter counter;
+	int value = 3;
+	++value;
+
+	EXPECT_EQ(4, value);
+	EXPECT_EQ(0, counter.count());
+}
+
+TEST(allocation_counter_Test, count_New_ReturnCount) {
+	const allocation_counter counter;
+	const std::unique_ptr<int> ptr = std::make_unique<int>(3);
+	const std::unique_ptr<int[]> array = std::make_unique<int[]>(3);  // NOLINT(cppcoreguidelines-avoid-c-arrays): Test for operator new[].
+
+	EXPECT_EQ(2, counter.count());
+}
+
+TEST(allocation_counter_Test, count_AlignedNew_ReturnCount) {
+	struct alignas(64) Aligned {
+		int value;
+	};
+
+	const allocation_counter counter;
+	const std::unique_ptr<Aligned> ptr = std::make_unique<Aligned>();
+
+	EXPECT_EQ(1, counter.count());
+}
+
+TEST(allocation_counter_Test, count_NoThrowNew_ReturnCount) {
+	const allocation_counter counter;
+	const std::unique_ptr<int> ptr(new (std::nothrow) int(3));
+
+	EXPECT_EQ(1, counter.count());
+}
+
+#if _DEBUG
+TEST(allocation_counter_Test, count_Malloc_ReturnCount) {
+	const allocation_counter counter;
+	void* const ptr = std::malloc(16);  // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc): Test for malloc.
+	std::free(ptr);                     // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc): Test for malloc.
+
+	EXPECT_EQ(1, counter.count());
+}
+#endif
+
+TEST(allocation_counter_Test, EXPECT_NO_ALLOCATIONS_NoAllocation_Pass) {
+	int value = 3;
+	EXPECT_NO_ALLOCATIONS({
+		++value;
+		++value;
+	});
+	EXPECT_EQ(5, value);
+}
+
+TEST(allocation_counter_Test, EXPECT_ALLOCATIONS_New_Pass) {
+	EXPECT_ALLOCATIONS(1, {
+		const std::unique_ptr<int> ptr = std::make_unique<int>(3);
+	});
+}
+
+}  // namespace
+}  // namespace m3c::test
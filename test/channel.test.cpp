@@ -0,0 +1,119 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/channel.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace m3c::test {
+namespace {
+
+TEST(channel_Test, try_push_Full_ReturnFalse) {
+	channel<int> chan(2);
+
+	EXPECT_TRUE(chan.try_push(1));
+	EXPECT_TRUE(chan.try_push(2));
+	EXPECT_FALSE(chan.try_push(3));
+}
+
+TEST(channel_Test, try_pop_Empty_ReturnNullopt) {
+	channel<int> chan(2);
+
+	EXPECT_FALSE(chan.try_pop().has_value());
+}
+
+TEST(channel_Test, pop_Empty_WaitForPush) {
+	channel<int> chan(2);
+
+	std::thread thread([&chan] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		chan.push(42);
+	});
+	EXPECT_EQ(42, chan.pop());
+	thread.join();
+}
+
+TEST(channel_Test, push_Full_WaitForPop) {
+	channel<int> chan(2);
+	chan.push(1);
+	chan.push(2);
+
+	std::thread thread([&chan] {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		EXPECT_EQ(1, chan.pop());
+	});
+	chan.push(3);
+	thread.join();
+
+	EXPECT_EQ(2, chan.pop());
+	EXPECT_EQ(3, chan.pop());
+}
+
+TEST(channel_Test, pop_n_Values_ReturnAvailable) {
+	channel<int> chan(8);
+	for (int i = 0; i < 5; ++i) {
+		chan.push(i);
+	}
+
+	std::vector<int> values;
+	EXPECT_EQ(3, chan.pop_n(std::back_inserter(values), 3));
+	EXPECT_EQ(2, chan.pop_n(std::back_inserter(values), 3));
+	EXPECT_EQ(0, chan.try_pop_n(std::back_inserter(values), 3));
+
+	EXPECT_EQ((std::vector<int>{0, 1, 2, 3, 4}), values);
+}
+
+TEST(channel_Test, push_Concurrent_TransferAll) {
+	constexpr std::uint32_t kProducers = 4;
+	constexpr std::uint64_t kCount = 20000;
+
+	channel<std::uint64_t> chan(16);
+	std::vector<std::thread> threads;
+
+	for (std::uint32_t i = 0; i < kProducers; ++i) {
+		threads.emplace_back([&chan] {
+			for (std::uint64_t value = 1; value <= kCount; ++value) {
+				chan.push(value);
+			}
+		});
+	}
+
+	std::uint64_t total = 0;
+	std::vector<std::uint64_t> values;
+	for (std::uint64_t n = 0; n < kProducers * kCount;) {
+		values.clear();
+		n += chan.pop_n(std::back_inserter(values), 8);
+		for (const std::uint64_t value : values) {
+			total += value;
+		}
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(kProducers * kCount * (kCount + 1) / 2, total);
+}
+
+}  // namespace
+}  // namespace m3c::test
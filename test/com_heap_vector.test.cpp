@@ -0,0 +1,255 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/com_heap_vector.h"
+
+#include <m4t/MallocSpy.h>
+#include <m4t/m4t.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <windows.h>
+#include <objbase.h>
+#include <propidl.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <utility>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+/// @brief An allocator using `malloc` which counts the calls.
+struct MallocAllocator final {
+	[[nodiscard]] static void* allocate(const std::size_t count, const std::size_t size) {
+		return reallocate(nullptr, count, size);
+	}
+
+	[[nodiscard]] static void* reallocate(void* const ptr, const std::size_t count, const std::size_t size) {
+		++s_allocations;
+		void* const result = std::realloc(ptr, count * size);  // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc): Test allocator.
+		if (!result) {
+			throw std::bad_alloc();
+		}
+		return result;
+	}
+
+	static void deallocate(void* const ptr) noexcept {
+		std::free(ptr);  // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc): Test allocator.
+	}
+
+	static inline std::uint32_t s_allocations = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Test counter.
+};
+
+static_assert(internal::HeapAllocator<internal::CoTaskMemAllocator>);
+static_assert(internal::HeapAllocator<MallocAllocator>);
+
+class com_heap_vector_Test : public t::Test {
+protected:
+	void SetUp() override {
+		MallocAllocator::s_allocations = 0;
+		ASSERT_HRESULT_SUCCEEDED(CoRegisterMallocSpy(&m_spy));
+	}
+
+	void TearDown() override {
+		EXPECT_EQ(0, m_spy.GetAllocatedCount());
+		EXPECT_HRESULT_SUCCEEDED(CoRevokeMallocSpy());
+	}
+
+protected:
+	m4t::MallocSpy m_spy;
+};
+
+//
+// com_heap_vector()
+//
+
+TEST_F(com_heap_vector_Test, ctor_Default_IsEmpty) {
+	const com_heap_vector<int> vector;
+
+	EXPECT_TRUE(vector.empty());
+	EXPECT_EQ(0, vector.size());
+	EXPECT_EQ(0, vector.capacity());
+	EXPECT_EQ(nullptr, vector.data());
+}
+
+TEST_F(com_heap_vector_Test, ctorMove_Value_ValueIsMoved) {
+	com_heap_vector<int> oth;
+	oth.push_back(7);
+
+	const com_heap_vector<int> vector(std::move(oth));
+
+	m4t::EnableMovedFromCheck(oth);
+	EXPECT_EQ(nullptr, oth.data());
+	EXPECT_EQ(0, oth.size());
+	ASSERT_EQ(1, vector.size());
+	EXPECT_EQ(7, vector[0]);
+}
+
+TEST_F(com_heap_vector_Test, opMove_ValueToValue_ValueIsMoved) {
+	com_heap_vector<int> oth;
+	oth.push_back(7);
+	com_heap_vector<int> vector;
+	vector.push_back(8);
+
+	vector = std::move(oth);
+
+	m4t::EnableMovedFromCheck(oth);
+	EXPECT_EQ(nullptr, oth.data());
+	ASSERT_EQ(1, vector.size());
+	EXPECT_EQ(7, vector[0]);
+}
+
+//
+// push_back / emplace_back
+//
+
+TEST_F(com_heap_vector_Test, push_back_Many_GrowGeometrically) {
+	com_heap_vector<int, MallocAllocator> vector;
+
+	for (int i = 0; i < 1000; ++i) {
+		vector.push_back(i);
+	}
+
+	ASSERT_EQ(1000, vector.size());
+	EXPECT_LE(1000, vector.capacity());
+	EXPECT_GE(10, MallocAllocator::s_allocations);
+	for (int i = 0; i < 1000; ++i) {
+		EXPECT_EQ(i, vector[i]);
+	}
+}
+
+TEST_F(com_heap_vector_Test, push_back_OwnElement_CopyValue) {
+	com_heap_vector<int> vector;
+	vector.push_back(5);
+	vector.shrink_to_fit();
+	ASSERT_EQ(vector.size(), vector.capacity());
+
+	vector.push_back(vector[0]);
+
+	EXPECT_THAT(vector, t::ElementsAre(5, 5));
+}
+
+TEST_F(com_heap_vector_Test, emplace_back_PropVariant_AddElement) {
+	com_heap_vector<PROPVARIANT> vector;
+
+	PROPVARIANT& pv = vector.emplace_back();
+	pv.vt = VT_UI4;
+	pv.ulVal = 3;
+
+	ASSERT_EQ(1, vector.size());
+	EXPECT_EQ(VT_UI4, vector[0].vt);
+	EXPECT_EQ(3, vector[0].ulVal);
+}
+
+//
+// reserve / shrink_to_fit / resize
+//
+
+TEST_F(com_heap_vector_Test, reserve_Count_AllocateOnce) {
+	com_heap_vector<int, MallocAllocator> vector;
+
+	vector.reserve(100);
+	for (int i = 0; i < 100; ++i) {
+		vector.push_back(i);
+	}
+
+	EXPECT_EQ(100, vector.capacity());
+	EXPECT_EQ(1, MallocAllocator::s_allocations);
+}
+
+TEST_F(com_heap_vector_Test, reserve_Smaller_DoNothing) {
+	com_heap_vector<int, MallocAllocator> vector;
+	vector.reserve(100);
+
+	vector.reserve(10);
+
+	EXPECT_EQ(100, vector.capacity());
+	EXPECT_EQ(1, MallocAllocator::s_allocations);
+}
+
+TEST_F(com_heap_vector_Test, shrink_to_fit_Elements_ReduceCapacity) {
+	com_heap_vector<int> vector;
+	vector.reserve(100);
+	vector.push_back(1);
+	vector.push_back(2);
+
+	vector.shrink_to_fit();
+
+	EXPECT_EQ(2, vector.capacity());
+	EXPECT_THAT(vector, t::ElementsAre(1, 2));
+}
+
+TEST_F(com_heap_vector_Test, shrink_to_fit_Empty_FreeMemory) {
+	com_heap_vector<int> vector;
+	vector.reserve(100);
+
+	vector.shrink_to_fit();
+
+	EXPECT_EQ(0, vector.capacity());
+	EXPECT_EQ(nullptr, vector.data());
+}
+
+TEST_F(com_heap_vector_Test, resize_Larger_ValueInitialize) {
+	com_heap_vector<int> vector;
+	vector.push_back(1);
+
+	vector.resize(3);
+
+	EXPECT_THAT(vector, t::ElementsAre(1, 0, 0));
+}
+
+TEST_F(com_heap_vector_Test, resize_Smaller_KeepCapacity) {
+	com_heap_vector<int> vector;
+	vector.resize(10);
+
+	vector.resize(2);
+
+	EXPECT_EQ(2, vector.size());
+	EXPECT_EQ(10, vector.capacity());
+}
+
+//
+// release
+//
+
+TEST_F(com_heap_vector_Test, release_Value_TransferOwnership) {
+	com_heap_vector<int> vector;
+	vector.push_back(1);
+
+	int* const p = vector.release();
+
+	EXPECT_NE(nullptr, p);
+	EXPECT_TRUE(vector.empty());
+	EXPECT_EQ(0, vector.capacity());
+	EXPECT_EQ(nullptr, vector.data());
+	EXPECT_EQ(1, m_spy.GetAllocatedCount());
+	CoTaskMemFree(p);
+}
+
+TEST_F(com_heap_vector_Test, release_Empty_ReturnNullptr) {
+	com_heap_vector<int> vector;
+
+	EXPECT_EQ(nullptr, vector.release());
+}
+
+}  // namespace
+}  // namespace m3c::test
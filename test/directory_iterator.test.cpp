@@ -0,0 +1,243 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/directory_iterator.h"
+
+#include "m3c/Handle.h"
+#include "m3c/exception.h"
+#include "m3c/finally.h"
+#include "m3c/mutex.h"
+
+#include <m4t/LogListener.h>
+
+#include "test.events.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <windows.h>
+#include <detours_gmock.h>
+#include <sddl.h>
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+class directory_iterator_Test : public t::Test {
+protected:
+	void SetUp() override {
+		std::array<wchar_t, MAX_PATH + 1> path;
+		ASSERT_NE(0, GetTempPathW(static_cast<DWORD>(path.size()), path.data()));
+		std::array<wchar_t, MAX_PATH + 1> fileName;
+		ASSERT_NE(0, GetTempFileNameW(path.data(), L"m3c", 0, fileName.data()));
+		ASSERT_TRUE(DeleteFileW(fileName.data()));
+		m_root = fileName.data();
+		ASSERT_TRUE(CreateDirectoryW(m_root.c_str(), nullptr));
+	}
+
+	void TearDown() override {
+		std::error_code errorCode;
+		std::filesystem::remove_all(m_root, errorCode);
+	}
+
+	void CreateTree() {
+		MakeFile(L"a.txt", "abc");
+		MakeFile(L"b.txt", "");
+		MakeDirectory(L"sub");
+		MakeFile(L"sub\\c.txt", "c");
+		MakeDirectory(L"sub\\nested");
+		MakeFile(L"sub\\nested\\d.txt", "d");
+	}
+
+	void MakeDirectory(const std::wstring& name) {
+		ASSERT_TRUE(CreateDirectoryW((m_root + L'\\' + name).c_str(), nullptr));
+	}
+
+	void MakeFile(const std::wstring& name, const std::string_view data) {
+		const Handle file = CreateFileW((m_root + L'\\' + name).c_str(), GENERIC_WRITE, 0, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+		ASSERT_TRUE(file);
+		DWORD written;
+		ASSERT_TRUE(::WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &written, nullptr));
+	}
+
+	void SetAccess(const std::wstring& name, _In_z_ const wchar_t* const sddl) {
+		PSECURITY_DESCRIPTOR pSecurityDescriptor = nullptr;
+		ASSERT_TRUE(ConvertStringSecurityDescriptorToSecurityDescriptorW(sddl, SDDL_REVISION_1, &pSecurityDescriptor, nullptr));
+		const auto release = finally([pSecurityDescriptor]() noexcept {
+			LocalFree(pSecurityDescriptor);
+		});
+		ASSERT_TRUE(SetFileSecurityW((m_root + L'\\' + name).c_str(), DACL_SECURITY_INFORMATION, pSecurityDescriptor));
+	}
+
+protected:
+	std::wstring m_root;
+};
+
+//
+// directory_iterator
+//
+
+TEST_F(directory_iterator_Test, ctor_Default_IsEnd) {
+	const directory_iterator it;
+
+	EXPECT_EQ(end(it), it);
+}
+
+TEST_F(directory_iterator_Test, ctor_NotFound_ThrowException) {
+	EXPECT_THROW(directory_iterator((m_root + L"\\missing").c_str()), windows_error);
+}
+
+TEST_F(directory_iterator_Test, ctor_Empty_IsEnd) {
+	const directory_iterator it(m_root.c_str());
+
+	EXPECT_EQ(directory_iterator(), it);
+}
+
+TEST_F(directory_iterator_Test, iterate_Tree_ReturnEntries) {
+	CreateTree();
+
+	std::vector<std::wstring> names;
+	for (const directory_entry& entry : directory_iterator(m_root.c_str())) {
+		names.emplace_back(entry.name);
+		if (entry.name == L"a.txt") {
+			EXPECT_FALSE(entry.is_directory());
+			EXPECT_EQ(3, entry.size);
+			EXPECT_NE(0, entry.lastWriteTime);
+		} else if (entry.name == L"sub") {
+			EXPECT_TRUE(entry.is_directory());
+		}
+	}
+
+	EXPECT_THAT(names, t::UnorderedElementsAre(L"a.txt", L"b.txt", L"sub"));
+}
+
+TEST_F(directory_iterator_Test, iterate_Handle_ReturnEntries) {
+	CreateTree();
+	Handle directory = CreateFileW(m_root.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+	ASSERT_TRUE(directory);
+
+	std::vector<std::wstring> names;
+	for (directory_iterator it(std::move(directory)); it != directory_iterator(); ++it) {
+		names.emplace_back(it->name);
+	}
+
+	EXPECT_THAT(names, t::UnorderedElementsAre(L"a.txt", L"b.txt", L"sub"));
+}
+
+TEST_F(directory_iterator_Test, iterate_ManyFiles_ReturnAllEntries) {
+	for (std::uint32_t i = 0; i < 2000; ++i) {
+		MakeFile(L"file_with_a_rather_long_name_to_fill_the_buffer_" + std::to_wstring(i) + L".txt", "");
+	}
+
+	std::uint32_t count = 0;
+	for (const directory_entry& entry : directory_iterator(m_root.c_str())) {
+		EXPECT_TRUE(entry.name.starts_with(L"file_with_a_rather_long_name_to_fill_the_buffer_"));
+		++count;
+	}
+
+	EXPECT_EQ(2000, count);
+}
+
+//
+// walk_directory
+//
+
+TEST_F(directory_iterator_Test, walk_directory_Tree_ReturnAllEntries) {
+	CreateTree();
+
+	mutex mtx;
+	std::vector<std::wstring> paths;
+	walk_directory(m_root, [this, &mtx, &paths](const std::wstring& directory, const directory_entry& entry) {
+		scoped_lock lock(mtx);
+		paths.emplace_back(directory.substr(m_root.size()) + L'\\' + std::wstring(entry.name));
+	});
+
+	EXPECT_THAT(paths, t::UnorderedElementsAre(L"\\a.txt", L"\\b.txt", L"\\sub", L"\\sub\\c.txt", L"\\sub\\nested", L"\\sub\\nested\\d.txt"));
+}
+
+TEST_F(directory_iterator_Test, walk_directory_SingleThread_ReturnAllEntries) {
+	CreateTree();
+
+	std::vector<std::wstring> names;
+	walk_directory(
+	    m_root, [&names](const std::wstring&, const directory_entry& entry) {
+		    names.emplace_back(entry.name);
+	    },
+	    1);
+
+	EXPECT_THAT(names, t::UnorderedElementsAre(L"a.txt", L"b.txt", L"sub", L"c.txt", L"nested", L"d.txt"));
+}
+
+TEST_F(directory_iterator_Test, walk_directory_Empty_NoEntries) {
+	std::uint32_t count = 0;
+	walk_directory(m_root, [&count](const std::wstring&, const directory_entry&) {
+		++count;
+	});
+
+	EXPECT_EQ(0, count);
+}
+
+TEST_F(directory_iterator_Test, walk_directory_CallbackThrows_ThrowException) {
+	CreateTree();
+
+	EXPECT_THROW(walk_directory(m_root, [](const std::wstring&, const directory_entry& entry) {
+		if (entry.name == L"d.txt") {
+			throw std::invalid_argument("test");
+		}
+	}),
+	             std::invalid_argument);
+}
+
+TEST_F(directory_iterator_Test, walk_directory_AccessDenied_SkipDirectory) {
+	m4t::LogListener log(m4t::LogListenerMode::kStrictEvent);
+	CreateTree();
+	MakeDirectory(L"denied");
+	MakeFile(L"denied\\e.txt", "e");
+	// deny listing the directory but keep all other rights for removing it afterwards
+	SetAccess(L"denied", L"D:P(D;;0x1;;;WD)(A;OICI;FA;;;WD)");
+	const auto restore = finally([this]() noexcept {
+		SetAccess(L"denied", L"D:P(A;OICI;FA;;;WD)");
+	});
+
+	EXPECT_CALL(log, Event(evt::directory_iterator_Skip_E.Id, DTGM_ARG3));
+
+	mutex mtx;
+	std::vector<std::wstring> paths;
+	walk_directory(m_root, [this, &mtx, &paths](const std::wstring& directory, const directory_entry& entry) {
+		scoped_lock lock(mtx);
+		paths.emplace_back(directory.substr(m_root.size()) + L'\\' + std::wstring(entry.name));
+	});
+
+	EXPECT_THAT(paths, t::UnorderedElementsAre(L"\\a.txt", L"\\b.txt", L"\\denied", L"\\sub", L"\\sub\\c.txt", L"\\sub\\nested", L"\\sub\\nested\\d.txt"));
+}
+
+TEST_F(directory_iterator_Test, walk_directory_NotFound_ThrowException) {
+	EXPECT_THROW(walk_directory(m_root + L"\\missing", [](const std::wstring&, const directory_entry&) {}), windows_error);
+}
+
+}  // namespace
+}  // namespace m3c::test
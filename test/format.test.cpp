@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "m3c/format.h"
 
+#include "allocation_counter.h"
+
 #include "m3c/PropVariant.h"
 #include "m3c/com_ptr.h"
 
@@ -26,6 +28,7 @@ limitations under the License.
 #include "test.events.h"
 
 #include <fmt/core.h>
+#include <fmt/format.h>
 #include <fmt/xchar.h>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -45,6 +48,8 @@ limitations under the License.
 #include <wincodec.h>
 #include <wtypes.h>
 
+#include <cstdint>
+#include <iterator>
 #include <span>
 #include <string>
 
@@ -1357,5 +1362,36 @@ TEST_F(format_Test, WICRect_Height_PrintHeight) {
 	EXPECT_EQ("160", str);
 }
 
+
+//
+// Allocations
+//
+
+/// @brief The number of allocations for a `std::string` which does not fit into the small string buffer.
+/// @details Containers allocate an additional proxy object if iterator debugging is enabled.
+constexpr std::uint64_t kStringAllocations = _ITERATOR_DEBUG_LEVEL == 0 ? 1 : 2;
+
+// not using format_Test because calls of the mocked functions allocate
+TEST(format_Allocations_Test, format_to_Inline_NoAllocations) {
+	fmt::memory_buffer buffer;
+
+	EXPECT_NO_ALLOCATIONS(fmt::format_to(std::back_inserter(buffer), "{} {} {}", 7, 1.5, "text"));
+	EXPECT_EQ("7 1.5 text", fmt::to_string(buffer));
+}
+
+TEST(format_Allocations_Test, format_to_GUID_AllocateString) {
+	constexpr GUID kGuid = {0x1e3a9b5c, 0x0f4d, 0x4c2e, {0x9a, 0x8b, 0x7c, 0x6d, 0x5e, 0x4f, 0x3a, 0x2b}};
+	fmt::memory_buffer buffer;
+
+	EXPECT_ALLOCATIONS(kStringAllocations, fmt::format_to(std::back_inserter(buffer), "{}", kGuid));
+	EXPECT_EQ("1e3a9b5c-0f4d-4c2e-9a8b-7c6d5e4f3a2b", fmt::to_string(buffer));
+}
+
+TEST(format_Allocations_Test, format_to_hresult_AllocateMessageAndResult) {
+	fmt::memory_buffer buffer;
+
+	EXPECT_ALLOCATIONS(2 * kStringAllocations, fmt::format_to(std::back_inserter(buffer), "{}", hresult(E_INVALIDARG)));
+}
+
 }  // namespace
 }  // namespace m3c::test
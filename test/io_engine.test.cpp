@@ -0,0 +1,198 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/io_engine.h"
+
+#include "m3c/Handle.h"
+
+#include <gtest/gtest.h>
+
+#include <windows.h>
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <string>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+/// @brief A minimal coroutine type which starts eagerly.
+struct Task {
+	struct promise_type {  // NOLINT(readability-identifier-naming): Name required by C++ standard.
+		Task get_return_object() noexcept {
+			return {};
+		}
+		std::suspend_never initial_suspend() noexcept {
+			return {};
+		}
+		std::suspend_never final_suspend() noexcept {
+			return {};
+		}
+		void return_void() noexcept {
+			// empty
+		}
+		void unhandled_exception() noexcept {
+			std::terminate();
+		}
+	};
+};
+
+class io_engine_Test : public t::Test {
+protected:
+	void SetUp() override {
+		std::array<wchar_t, MAX_PATH + 1> path;
+		ASSERT_NE(0, GetTempPathW(static_cast<DWORD>(path.size()), path.data()));
+		std::array<wchar_t, MAX_PATH + 1> fileName;
+		ASSERT_NE(0, GetTempFileNameW(path.data(), L"m3c", 0, fileName.data()));
+
+		m_file = CreateFileW(fileName.data(), GENERIC_READ | GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE | FILE_FLAG_OVERLAPPED, nullptr);
+		ASSERT_TRUE(m_file);
+
+		m_engine.associate(m_file);
+	}
+
+	void Write(const std::string& data) {
+		io_result result = {ERROR_INTERNAL_ERROR, 0};
+		m_engine.write(m_file, 0, std::as_bytes(std::span(data)), [&result](const io_result& r) {
+			result = r;
+		});
+		EXPECT_EQ(1, m_engine.pending());
+		m_engine.run();
+
+		ASSERT_EQ(ERROR_SUCCESS, result.error);
+		ASSERT_EQ(data.size(), result.bytes);
+	}
+
+protected:
+	io_engine m_engine;
+	Handle m_file;
+};
+
+TEST_F(io_engine_Test, read_Callback_ReturnData) {
+	Write("Hello World");
+
+	std::array<std::byte, 5> buffer;
+	io_result result = {ERROR_INTERNAL_ERROR, 0};
+	m_engine.read(m_file, 6, buffer, [&result](const io_result& r) {
+		result = r;
+	});
+	m_engine.run();
+
+	EXPECT_EQ(ERROR_SUCCESS, result.error);
+	ASSERT_EQ(5, result.bytes);
+	EXPECT_EQ("World", std::string(reinterpret_cast<const char*>(buffer.data()), result.bytes));
+	EXPECT_EQ(0, m_engine.pending());
+}
+
+TEST_F(io_engine_Test, read_Many_ReturnAllInBatch) {
+	Write("0123456789");
+
+	std::array<std::array<std::byte, 1>, 10> buffers;
+	std::uint32_t completed = 0;
+	for (std::uint32_t i = 0; i < buffers.size(); ++i) {
+		m_engine.read(m_file, i, buffers[i], [&completed](const io_result& r) {
+			EXPECT_EQ(ERROR_SUCCESS, r.error);
+			EXPECT_EQ(1, r.bytes);
+			++completed;
+		});
+	}
+	m_engine.run();
+
+	EXPECT_EQ(10, completed);
+	for (std::uint32_t i = 0; i < buffers.size(); ++i) {
+		EXPECT_EQ(static_cast<std::byte>('0' + i), buffers[i][0]);
+	}
+}
+
+TEST_F(io_engine_Test, read_AfterEndOfFile_ReturnError) {
+	Write("data");
+
+	std::array<std::byte, 4> buffer;
+	io_result result = {ERROR_SUCCESS, 0};
+	m_engine.read(m_file, 100, buffer, [&result](const io_result& r) {
+		result = r;
+	});
+	m_engine.run();
+
+	EXPECT_EQ(ERROR_HANDLE_EOF, result.error);
+	EXPECT_EQ(0, result.bytes);
+}
+
+TEST_F(io_engine_Test, read_BufferTooLarge_ThrowException) {
+	if constexpr (sizeof(std::size_t) <= sizeof(DWORD)) {
+		GTEST_SKIP() << "Requires 64 bit build";
+	} else {
+		std::array<std::byte, 1> buffer;
+		// memory is never accessed because size is checked first
+		const std::span<std::byte> tooLarge(buffer.data(), static_cast<std::size_t>(MAXDWORD) + 1);
+
+		EXPECT_THROW(m_engine.read(m_file, 0, tooLarge, nullptr), std::length_error);
+		EXPECT_EQ(0, m_engine.pending());
+	}
+}
+
+TEST_F(io_engine_Test, read_async_Coroutine_ReturnData) {
+	Write("Hello World");
+
+	std::array<std::byte, 5> buffer;
+	io_result result = {ERROR_INTERNAL_ERROR, 0};
+	const auto coroutine = [this, &buffer, &result]() -> Task {
+		result = co_await m_engine.read_async(m_file, 0, buffer);
+	};
+	coroutine();
+	m_engine.run();
+
+	EXPECT_EQ(ERROR_SUCCESS, result.error);
+	ASSERT_EQ(5, result.bytes);
+	EXPECT_EQ("Hello", std::string(reinterpret_cast<const char*>(buffer.data()), result.bytes));
+}
+
+TEST_F(io_engine_Test, poll_CallbackThrows_RunAllCallbacks) {
+	Write("0123456789");
+
+	std::array<std::array<std::byte, 1>, 4> buffers;
+	std::uint32_t completed = 0;
+	for (std::uint32_t i = 0; i < buffers.size(); ++i) {
+		m_engine.read(m_file, i, buffers[i], [&completed](const io_result&) {
+			++completed;
+			throw std::runtime_error("callback");
+		});
+	}
+	while (m_engine.pending()) {
+		EXPECT_THROW(m_engine.poll(std::chrono::milliseconds(INFINITE)), std::runtime_error);
+	}
+
+	EXPECT_EQ(4, completed);
+}
+
+TEST_F(io_engine_Test, poll_NoOperation_ReturnZero) {
+	EXPECT_EQ(0, m_engine.poll());
+}
+
+TEST_F(io_engine_Test, poll_NegativeTimeout_ReturnZero) {
+	EXPECT_EQ(0, m_engine.poll(std::chrono::milliseconds(-1)));
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -0,0 +1,158 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/lazy.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+constinit lazy<std::string> g_constinit;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Test for constinit.
+
+class Counted {
+public:
+	Counted() noexcept {
+		++s_constructed;
+	}
+	explicit Counted(const int value) noexcept
+	    : m_value(value) {
+		++s_constructed;
+	}
+	~Counted() noexcept {
+		++s_destructed;
+	}
+
+public:
+	int m_value = 0;
+
+	static inline int s_constructed = 0;
+	static inline int s_destructed = 0;
+};
+
+class lazy_Test : public t::Test {
+protected:
+	void SetUp() override {
+		Counted::s_constructed = 0;
+		Counted::s_destructed = 0;
+	}
+};
+
+//
+// once_flag
+//
+
+TEST(once_flag_Test, call_once_Repeated_CallOnce) {
+	once_flag flag;
+	int calls = 0;
+
+	EXPECT_FALSE(flag.is_done());
+	call_once(flag, [&calls] { ++calls; });
+	call_once(flag, [&calls] { ++calls; });
+
+	EXPECT_EQ(1, calls);
+	EXPECT_TRUE(flag.is_done());
+}
+
+TEST(once_flag_Test, call_once_Exception_CallAgain) {
+	once_flag flag;
+	int calls = 0;
+
+	EXPECT_THROW(call_once(flag, [&calls] {
+		++calls;
+		throw std::runtime_error("test");
+	}),
+	             std::runtime_error);
+	EXPECT_FALSE(flag.is_done());
+
+	call_once(flag, [&calls] { ++calls; });
+	EXPECT_EQ(2, calls);
+	EXPECT_TRUE(flag.is_done());
+}
+
+TEST(once_flag_Test, call_once_Concurrent_CallOnce) {
+	once_flag flag;
+	std::atomic<int> calls = 0;
+
+	std::vector<std::thread> threads;
+	for (int i = 0; i < 8; ++i) {
+		threads.emplace_back([&flag, &calls] {
+			call_once(flag, [&calls] {
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+				++calls;
+			});
+			EXPECT_TRUE(flag.is_done());
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(1, calls);
+}
+
+//
+// lazy
+//
+
+TEST_F(lazy_Test, ctor_Default_NoValue) {
+	{
+		lazy<Counted> value;
+		EXPECT_FALSE(value.has_value());
+	}
+	EXPECT_EQ(0, Counted::s_constructed);
+	EXPECT_EQ(0, Counted::s_destructed);
+}
+
+TEST_F(lazy_Test, get_Repeated_ConstructOnce) {
+	{
+		lazy<Counted> value;
+		EXPECT_EQ(0, value.get().m_value);
+		EXPECT_EQ(&value.get(), &*value);
+		EXPECT_TRUE(value.has_value());
+		EXPECT_EQ(1, Counted::s_constructed);
+	}
+	EXPECT_EQ(1, Counted::s_destructed);
+}
+
+TEST_F(lazy_Test, emplace_Arguments_UseArguments) {
+	{
+		lazy<Counted> value;
+		EXPECT_EQ(7, value.emplace(7).m_value);
+		EXPECT_EQ(7, value.emplace(8).m_value);
+		EXPECT_EQ(7, value->m_value);
+		EXPECT_EQ(1, Counted::s_constructed);
+	}
+	EXPECT_EQ(1, Counted::s_destructed);
+}
+
+TEST_F(lazy_Test, get_constinit_ReturnValue) {
+	g_constinit.emplace("test");
+
+	EXPECT_EQ("test", *g_constinit);
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -16,6 +16,8 @@ limitations under the License.
 
 #include "m3c/lazy_string.h"
 
+#include "allocation_counter.h"
+
 #include "m3c/Log.h"
 #include "m3c/exception.h"
 #include "m3c/type_traits.h"
@@ -1887,5 +1889,18 @@ TYPED_TEST(lazy_string_CharT_Test, LogException_Value_LogValue) {
 	}
 }
 
+//
+// Allocations
+//
+
+TEST_F(lazy_string_Test, Allocations_Inline_NoAllocations) {
+	EXPECT_NO_ALLOCATIONS({
+		StringT lazyString(kInline);
+		StringT copy(lazyString);
+		StringT move(std::move(copy));
+		const AlwaysInlineT other(lazyString);
+	});
+}
+
 }  // namespace
 }  // namespace m3c::test
@@ -0,0 +1,237 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/leak_tracker.h"
+
+#include "m3c/Handle.h"
+#include "m3c/com_heap_ptr.h"
+#include "m3c/source_location.h"
+
+#include <gtest/gtest.h>
+
+#include <windows.h>
+#include <objbase.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+static_assert(leak_tracker::kEnabled, "tests MUST be built with M3C_TRACK_RESOURCES=1");
+
+class leak_tracker_Test : public t::Test {
+protected:
+	void TearDown() override {
+		leak_tracker::set_sample_rate(1);
+	}
+
+	[[nodiscard]] static std::optional<tracked_resource> Find(const void* const key) {
+		std::optional<tracked_resource> result;
+		leak_tracker::for_each([key, &result](const tracked_resource& resource) {
+			if (resource.key == key) {
+				result = resource;
+			}
+		});
+		return result;
+	}
+
+	[[nodiscard]] static HANDLE NewEvent() noexcept {
+		return CreateEventW(nullptr, TRUE, FALSE, nullptr);
+	}
+};
+
+//
+// BaseHandle
+//
+
+TEST_F(leak_tracker_Test, Handle_Value_IsTracked) {
+	const std::uint_least32_t line = std::source_location::current().line() + 1;
+	const Handle handle = NewEvent();
+
+	const std::optional<tracked_resource> resource = Find(handle);
+	ASSERT_TRUE(resource.has_value());
+	EXPECT_EQ(line, resource->location.line());
+	EXPECT_TRUE(std::string_view(resource->location.file_name()).ends_with("leak_tracker.test.cpp"));
+	EXPECT_EQ(GetCurrentThreadId(), resource->threadId);
+}
+
+TEST_F(leak_tracker_Test, Handle_Closed_IsNotTracked) {
+	Handle handle = NewEvent();
+	const HANDLE hNative = handle;
+
+	handle.close();
+
+	EXPECT_FALSE(Find(hNative).has_value());
+}
+
+TEST_F(leak_tracker_Test, Handle_Destroyed_IsNotTracked) {
+	HANDLE hNative;  // NOLINT(cppcoreguidelines-init-variables): Set in block.
+	{
+		const Handle handle = NewEvent();
+		hNative = handle;
+	}
+
+	EXPECT_FALSE(Find(hNative).has_value());
+}
+
+TEST_F(leak_tracker_Test, Handle_Moved_IsTracked) {
+	const std::uint_least32_t line = std::source_location::current().line() + 1;
+	Handle handle = NewEvent();
+	const Handle moved(std::move(handle));
+
+	const std::optional<tracked_resource> resource = Find(moved);
+	ASSERT_TRUE(resource.has_value());
+	EXPECT_EQ(line, resource->location.line());
+}
+
+TEST_F(leak_tracker_Test, Handle_MoveAssigned_IsTracked) {
+	Handle handle = NewEvent();
+	Handle moved = NewEvent();
+	const HANDLE hPrevious = moved;
+
+	moved = std::move(handle);
+
+	EXPECT_TRUE(Find(moved).has_value());
+	EXPECT_FALSE(Find(hPrevious).has_value());
+}
+
+TEST_F(leak_tracker_Test, Handle_Released_IsNotTracked) {
+	Handle handle = NewEvent();
+
+	const HANDLE hNative = handle.release();
+
+	EXPECT_FALSE(Find(hNative).has_value());
+	EXPECT_TRUE(CloseHandle(hNative));
+}
+
+TEST_F(leak_tracker_Test, Handle_Assigned_IsTracked) {
+	Handle handle;
+
+	handle = NewEvent();
+
+	EXPECT_TRUE(Find(handle).has_value());
+}
+
+//
+// com_heap_ptr
+//
+
+TEST_F(leak_tracker_Test, com_heap_ptr_Allocated_IsTracked) {
+	const com_heap_ptr<wchar_t> ptr(16);
+
+	EXPECT_TRUE(Find(ptr.get()).has_value());
+}
+
+TEST_F(leak_tracker_Test, com_heap_ptr_Moved_IsTracked) {
+	const std::uint_least32_t line = std::source_location::current().line() + 1;
+	com_heap_ptr<wchar_t> ptr(16);
+	const com_heap_ptr<wchar_t> moved(std::move(ptr));
+
+	const std::optional<tracked_resource> resource = Find(moved.get());
+	ASSERT_TRUE(resource.has_value());
+	EXPECT_EQ(line, resource->location.line());
+}
+
+TEST_F(leak_tracker_Test, com_heap_ptr_MoveAssigned_IsTracked) {
+	com_heap_ptr<wchar_t> ptr(16);
+	com_heap_ptr<wchar_t> moved(16);
+	const wchar_t* const pPrevious = moved.get();
+
+	moved = std::move(ptr);
+
+	EXPECT_TRUE(Find(moved.get()).has_value());
+	EXPECT_FALSE(Find(pPrevious).has_value());
+}
+
+TEST_F(leak_tracker_Test, com_heap_ptr_Released_IsNotTracked) {
+	com_heap_ptr<wchar_t> ptr(16);
+
+	wchar_t* const p = ptr.release();
+
+	EXPECT_FALSE(Find(p).has_value());
+	CoTaskMemFree(p);
+}
+
+TEST_F(leak_tracker_Test, com_heap_ptr_Reallocated_NewAddressIsTracked) {
+	com_heap_ptr<wchar_t> ptr(16);
+
+	ptr.realloc(4096);
+
+	EXPECT_TRUE(Find(ptr.get()).has_value());
+}
+
+TEST_F(leak_tracker_Test, com_heap_ptr_Freed_IsNotTracked) {
+	com_heap_ptr<wchar_t> ptr(16);
+	const wchar_t* const p = ptr.get();
+
+	ptr = nullptr;
+
+	EXPECT_FALSE(Find(p).has_value());
+}
+
+//
+// sampling and table
+//
+
+TEST_F(leak_tracker_Test, set_sample_rate_Rate_TrackSomeResources) {
+	leak_tracker::set_sample_rate(4);
+
+	std::array<Handle, 256> handles;
+	for (Handle& handle : handles) {
+		handle = NewEvent();
+	}
+
+	std::uint32_t tracked = 0;
+	for (const Handle& handle : handles) {
+		if (Find(handle)) {
+			++tracked;
+		}
+	}
+	EXPECT_LT(0, tracked);
+	EXPECT_GT(handles.size() / 2, tracked);
+}
+
+TEST_F(leak_tracker_Test, size_ManyResources_GrowAndShrink) {
+	const std::size_t size = leak_tracker::size();
+	{
+		std::array<Handle, 1000> handles;
+		for (Handle& handle : handles) {
+			handle = NewEvent();
+		}
+
+		EXPECT_EQ(size + handles.size(), leak_tracker::size());
+		for (const Handle& handle : handles) {
+			EXPECT_TRUE(Find(handle).has_value());
+		}
+	}
+
+	EXPECT_EQ(size, leak_tracker::size());
+}
+
+TEST_F(leak_tracker_Test, dump_Resources_DoNotThrow) {
+	const Handle handle = NewEvent();
+
+	leak_tracker::dump();
+}
+
+}  // namespace
+}  // namespace m3c::test
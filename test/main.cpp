@@ -49,6 +49,11 @@ int main(int argc, char** argv) {
 		CoUninitialize();
 	});
 
+#ifndef M3C_TEST_LOG_PENDING
+	// tests expect events to be written synchronously
+	m3c::Log::WaitForRegistration();
+#endif
+
 	t::InitGoogleMock(&argc, argv);
 	const int result = RUN_ALL_TESTS();
 
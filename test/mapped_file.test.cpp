@@ -0,0 +1,276 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/mapped_file.h"
+
+#include "m3c/Handle.h"
+#include "m3c/exception.h"
+
+#include <m4t/m4t.h>
+
+#include <gtest/gtest.h>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+class mapped_file_Test : public t::Test {
+protected:
+	void SetUp() override {
+		std::array<wchar_t, MAX_PATH + 1> path;
+		ASSERT_NE(0, GetTempPathW(static_cast<DWORD>(path.size()), path.data()));
+		ASSERT_NE(0, GetTempFileNameW(path.data(), L"m3c", 0, m_fileName.data()));
+	}
+
+	void TearDown() override {
+		DeleteFileW(m_fileName.data());
+	}
+
+	void Write(const std::string_view data) {
+		const Handle file = CreateFileW(m_fileName.data(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY, nullptr);
+		ASSERT_TRUE(file);
+		DWORD written;
+		ASSERT_TRUE(WriteFile(file, data.data(), static_cast<DWORD>(data.size()), &written, nullptr));
+		ASSERT_EQ(data.size(), written);
+	}
+
+	[[nodiscard]] std::string Read() {
+		const Handle file = CreateFileW(m_fileName.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		EXPECT_TRUE(file);
+		std::string data(64, '\0');
+		DWORD read = 0;
+		EXPECT_TRUE(ReadFile(file, data.data(), static_cast<DWORD>(data.size()), &read, nullptr));
+		data.resize(read);
+		return data;
+	}
+
+	[[nodiscard]] static std::string_view ToString(const mapped_view& view) {
+		return {reinterpret_cast<const char*>(view.data()), view.size()};
+	}
+
+protected:
+	std::array<wchar_t, MAX_PATH + 1> m_fileName;
+};
+
+//
+// mapped_file
+//
+
+TEST_F(mapped_file_Test, ctor_Path_HasSize) {
+	Write("Hello World");
+
+	const mapped_file file(m_fileName.data());
+
+	EXPECT_EQ(11, file.size());
+	EXPECT_EQ(mapped_file::mode::kReadOnly, file.access());
+}
+
+TEST_F(mapped_file_Test, ctor_PathNotFound_ThrowsException) {
+	EXPECT_THROW(mapped_file(L"m3c_does_not_exist.txt"), windows_error);
+}
+
+TEST_F(mapped_file_Test, ctor_Handle_HasSize) {
+	Write("Hello World");
+	Handle handle = CreateFileW(m_fileName.data(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	ASSERT_TRUE(handle);
+
+	const mapped_file file(std::move(handle));
+
+	EXPECT_EQ(11, file.size());
+}
+
+TEST_F(mapped_file_Test, map_All_ReturnData) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map();
+
+	EXPECT_TRUE(view);
+	EXPECT_EQ(0, view.offset());
+	EXPECT_EQ(11, view.bytes().size());
+	EXPECT_EQ("Hello World", ToString(view));
+}
+
+TEST_F(mapped_file_Test, map_Window_ReturnData) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map(6, 3);
+
+	EXPECT_EQ(6, view.offset());
+	EXPECT_EQ("Wor", ToString(view));
+}
+
+TEST_F(mapped_file_Test, map_PastEnd_ReturnRemainder) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map(6, 100);
+
+	EXPECT_EQ("World", ToString(view));
+}
+
+TEST_F(mapped_file_Test, map_AfterEnd_ReturnEmpty) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map(11);
+
+	EXPECT_FALSE(view);
+	EXPECT_EQ(0, view.size());
+}
+
+TEST_F(mapped_file_Test, map_EmptyFile_ReturnEmpty) {
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map();
+
+	EXPECT_EQ(0, file.size());
+	EXPECT_FALSE(view);
+}
+
+TEST_F(mapped_file_Test, map_LargeOffset_ReturnData) {
+	std::string data(200000, 'x');
+	data[150000] = 'y';
+	Write(data);
+	const mapped_file file(m_fileName.data());
+
+	const mapped_view view = file.map(150000, 2);
+
+	EXPECT_EQ("yx", ToString(view));
+}
+
+TEST_F(mapped_file_Test, map_ReadWrite_WriteToFile) {
+	Write("Hello World");
+	{
+		const mapped_file file(m_fileName.data(), mapped_file::mode::kReadWrite);
+		mapped_view view = file.map(6);
+
+		EXPECT_TRUE(view.writable());
+		std::ranges::copy(std::string_view("Earth"), reinterpret_cast<char*>(view.writable_bytes().data()));
+		view.flush();
+	}
+
+	EXPECT_EQ("Hello Earth", Read());
+}
+
+TEST_F(mapped_file_Test, map_ReadOnly_WriteThrowsException) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+	mapped_view view = file.map();
+
+	EXPECT_FALSE(view.writable());
+	EXPECT_THROW(static_cast<void>(view.writable_bytes()), std::logic_error);
+}
+
+TEST_F(mapped_file_Test, remap_Window_MoveView) {
+	Write("0123456789");
+	const mapped_file file(m_fileName.data());
+	mapped_view view = file.map(0, 4);
+
+	file.remap(view, 4, 4);
+	EXPECT_EQ(4, view.offset());
+	EXPECT_EQ("4567", ToString(view));
+
+	file.remap(view, 8, 4);
+	EXPECT_EQ("89", ToString(view));
+
+	file.remap(view, 12, 4);
+	EXPECT_FALSE(view);
+}
+
+//
+// mapped_view
+//
+
+TEST_F(mapped_file_Test, view_ctor_Default_IsEmpty) {
+	const mapped_view view;
+
+	EXPECT_FALSE(view);
+	EXPECT_EQ(nullptr, view.data());
+	EXPECT_EQ(0, view.size());
+}
+
+TEST_F(mapped_file_Test, view_ctorMove_Value_ValueIsMoved) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+	mapped_view view = file.map();
+
+	const mapped_view moved(std::move(view));
+
+	m4t::EnableMovedFromCheck(view);
+	EXPECT_FALSE(view);
+	EXPECT_EQ("Hello World", ToString(moved));
+}
+
+TEST_F(mapped_file_Test, view_opMove_ValueToValue_ValueIsMoved) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+	mapped_view view = file.map(0, 5);
+	mapped_view other = file.map(6);
+
+	other = std::move(view);
+
+	m4t::EnableMovedFromCheck(view);
+	EXPECT_FALSE(view);
+	EXPECT_EQ("Hello", ToString(other));
+}
+
+TEST_F(mapped_file_Test, view_prefetch_Data_DataIsUnchanged) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+	const mapped_view view = file.map();
+
+	view.prefetch();
+
+	EXPECT_EQ("Hello World", ToString(view));
+}
+
+TEST_F(mapped_file_Test, view_close_Data_IsEmpty) {
+	Write("Hello World");
+	const mapped_file file(m_fileName.data());
+	mapped_view view = file.map();
+
+	view.close();
+
+	EXPECT_FALSE(view);
+	EXPECT_EQ(0, view.size());
+}
+
+TEST_F(mapped_file_Test, view_dtor_AfterFile_DataIsValid) {
+	Write("Hello World");
+	mapped_view view;
+	{
+		const mapped_file file(m_fileName.data());
+		view = file.map();
+	}
+
+	EXPECT_EQ("Hello World", ToString(view));
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -0,0 +1,65 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+
+#include <windows.h>
+
+#include <string>
+
+import m3c;
+
+namespace m3c::test {
+namespace {
+
+//
+// import m3c
+//
+
+TEST(modules_Test, import_UniquePtr_IsUsable) {
+	const unique_ptr<int> ptr = make_unique<int>(7);
+
+	ASSERT_NE(nullptr, ptr);
+	EXPECT_EQ(7, *ptr);
+}
+
+TEST(modules_Test, import_String_IsUsable) {
+	const lazy_wstring<32> str(L"test");
+
+	EXPECT_EQ("test", EncodeUtf8(str.c_str()));
+}
+
+TEST(modules_Test, import_Finally_IsUsable) {
+	int i = 3;
+	{
+		const auto f = finally([&i]() noexcept {
+			++i;
+		});
+	}
+	EXPECT_EQ(4, i);
+}
+
+TEST(modules_Test, import_TypeList_IsUsable) {
+	static_assert(index_of_v<long, type_list<int, long>> == 1);
+	static_assert(contains_v<int, type_list<int, long>>);
+}
+
+TEST(modules_Test, import_Exception_IsUsable) {
+	EXPECT_THROW(throw windows_error(ERROR_ACCESS_DENIED) + evt::Default, windows_error);
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -0,0 +1,122 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace m3c::test {
+namespace {
+
+TEST(mpmc_queue_Test, ctor_Capacity_RoundUpToPowerOfTwo) {
+	const mpmc_queue<int> queue(5);
+
+	EXPECT_EQ(8, queue.capacity());
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(mpmc_queue_Test, try_push_Full_ReturnFalse) {
+	mpmc_queue<int> queue(4);
+
+	for (int i = 0; i < 4; ++i) {
+		EXPECT_TRUE(queue.try_push(i));
+	}
+	EXPECT_FALSE(queue.try_push(4));
+	EXPECT_EQ(4, queue.size());
+}
+
+TEST(mpmc_queue_Test, try_pop_Empty_ReturnNullopt) {
+	mpmc_queue<int> queue(4);
+
+	EXPECT_FALSE(queue.try_pop().has_value());
+}
+
+TEST(mpmc_queue_Test, try_pop_Values_ReturnInOrder) {
+	mpmc_queue<std::string> queue(2);
+
+	for (int round = 0; round < 3; ++round) {
+		EXPECT_TRUE(queue.try_push(std::string("first")));
+		EXPECT_TRUE(queue.try_emplace(std::string(6, 'x')));
+
+		EXPECT_EQ("first", queue.try_pop());
+		EXPECT_EQ("xxxxxx", queue.try_pop());
+		EXPECT_FALSE(queue.try_pop().has_value());
+	}
+}
+
+TEST(mpmc_queue_Test, dtor_NotEmpty_DestroyElements) {
+	const std::shared_ptr<int> value = std::make_shared<int>(7);
+	{
+		mpmc_queue<std::shared_ptr<int>> queue(4);
+		EXPECT_TRUE(queue.try_push(value));
+		EXPECT_TRUE(queue.try_push(value));
+		EXPECT_EQ(3, value.use_count());
+	}
+	EXPECT_EQ(1, value.use_count());
+}
+
+TEST(mpmc_queue_Test, try_push_Concurrent_TransferAll) {
+	constexpr std::uint32_t kProducers = 4;
+	constexpr std::uint32_t kConsumers = 4;
+	constexpr std::uint64_t kCount = 20000;
+
+	mpmc_queue<std::uint64_t> queue(64);
+	std::vector<std::uint64_t> sums(kConsumers);
+	std::vector<std::thread> threads;
+
+	for (std::uint32_t i = 0; i < kProducers; ++i) {
+		threads.emplace_back([&queue] {
+			for (std::uint64_t value = 1; value <= kCount; ++value) {
+				while (!queue.try_push(value)) {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (std::uint32_t i = 0; i < kConsumers; ++i) {
+		threads.emplace_back([&queue, &sum = sums[i]] {
+			for (std::uint64_t n = 0; n < kCount;) {
+				if (const std::optional<std::uint64_t> value = queue.try_pop(); value) {
+					sum += *value;
+					++n;
+				} else {
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	std::uint64_t total = 0;
+	for (const std::uint64_t sum : sums) {
+		total += sum;
+	}
+	EXPECT_EQ(kProducers * kCount * (kCount + 1) / 2, total);
+	EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace
+}  // namespace m3c::test
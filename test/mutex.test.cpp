@@ -18,7 +18,11 @@ limitations under the License.
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
 
 namespace m3c::test {
 namespace {
@@ -39,5 +43,148 @@ TEST(mutex_Test, shared_lock) {
 	EXPECT_FALSE(cond.wait_for(lock, std::chrono::milliseconds(2)));
 }
 
+TEST(mutex_Test, wait_for_SubMillisecond_WaitsForDuration) {
+	mutex mtx;
+	condition_variable cond;
+
+	scoped_lock lock(mtx);
+	const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	EXPECT_FALSE(cond.wait_for(lock, std::chrono::microseconds(200)));
+	EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::microseconds(200));
+}
+
+TEST(mutex_Test, wait_until_DeadlineReached_ReturnFalse) {
+	mutex mtx;
+	condition_variable cond;
+
+	shared_lock lock(mtx);
+	const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+	EXPECT_FALSE(cond.wait_until(lock, deadline));
+	EXPECT_GE(std::chrono::steady_clock::now(), deadline);
+}
+
+TEST(mutex_Test, wait_until_DeadlinePassed_ReturnFalse) {
+	mutex mtx;
+	condition_variable cond;
+
+	scoped_lock lock(mtx);
+	EXPECT_FALSE(cond.wait_until(lock, std::chrono::steady_clock::now() - std::chrono::seconds(1)));
+}
+
+TEST(mutex_Test, wait_for_PredicateTrue_ReturnTrue) {
+	mutex mtx;
+	condition_variable cond;
+
+	scoped_lock lock(mtx);
+	EXPECT_TRUE(cond.wait_for(lock, std::chrono::hours(1), [] { return true; }));
+}
+
+TEST(mutex_Test, wait_until_PredicateFalse_ReturnFalse) {
+	mutex mtx;
+	condition_variable cond;
+	int calls = 0;
+
+	shared_lock lock(mtx);
+	EXPECT_FALSE(cond.wait_until(lock, std::chrono::steady_clock::now() + std::chrono::milliseconds(2), [&calls] {
+		++calls;
+		return false;
+	}));
+	EXPECT_GE(calls, 2);
+}
+
+TEST(mutex_Test, wait_Predicate_ReturnWhenNotified) {
+	mutex mtx;
+	condition_variable cond;
+	bool ready = false;
+
+	std::thread thread([&mtx, &cond, &ready] {
+		scoped_lock lock(mtx);
+		ready = true;
+		cond.notify_all();
+	});
+
+	{
+		scoped_lock lock(mtx);
+		cond.wait(lock, [&ready] { return ready; });
+		EXPECT_TRUE(ready);
+	}
+	thread.join();
+}
+
+//
+// queue_mutex
+//
+
+TEST(queue_mutex_Test, try_lock_Unlocked_ReturnTrue) {
+	queue_mutex mtx;
+
+	ASSERT_TRUE(mtx.try_lock());
+	mtx.unlock();
+}
+
+TEST(queue_mutex_Test, try_lock_Locked_ReturnFalse) {
+	queue_mutex mtx;
+
+	queue_lock lock(mtx);
+	std::thread thread([&mtx] {
+		EXPECT_FALSE(mtx.try_lock());
+	});
+	thread.join();
+}
+
+TEST(queue_mutex_Test, lock_Nested_LockAll) {
+	std::array<queue_mutex, 20> mutexes;
+
+	for (queue_mutex& mtx : mutexes) {
+		mtx.lock();
+	}
+	for (queue_mutex& mtx : mutexes) {
+		mtx.unlock();
+	}
+	for (queue_mutex& mtx : mutexes) {
+		EXPECT_TRUE(mtx.try_lock());
+		mtx.unlock();
+	}
+}
+
+TEST(queue_mutex_Test, lock_Contended_IsExclusive) {
+	constexpr std::uint32_t kThreads = 8;
+	constexpr std::uint32_t kIterations = 10000;
+
+	queue_mutex mtx;
+	std::uint32_t counter = 0;
+
+	std::vector<std::thread> threads;
+	for (std::uint32_t i = 0; i < kThreads; ++i) {
+		threads.emplace_back([&mtx, &counter] {
+			for (std::uint32_t j = 0; j < kIterations; ++j) {
+				queue_lock lock(mtx);
+				++counter;
+			}
+		});
+	}
+	for (std::thread& thread : threads) {
+		thread.join();
+	}
+
+	EXPECT_EQ(kThreads * kIterations, counter);
+}
+
+TEST(queue_mutex_Test, lock_LongWait_ParkAndWake) {
+	queue_mutex mtx;
+	bool done = false;
+
+	mtx.lock();
+	std::thread thread([&mtx, &done] {
+		queue_lock lock(mtx);
+		done = true;
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(50));
+	mtx.unlock();
+	thread.join();
+
+	EXPECT_TRUE(done);
+}
+
 }  // namespace
 }  // namespace m3c::test
@@ -0,0 +1,63 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/source_location.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace m3c::test {
+namespace {
+
+static_assert(internal::GetSourceRootLength("C:/src/project/file.cpp", "C:/src/project/") == 15);
+static_assert(internal::GetSourceRootLength("c:\\src\\Project\\file.cpp", "C:/src/project/") == 15);
+static_assert(internal::GetSourceRootLength("C:/src/other/file.cpp", "C:/src/project/") == 0);
+static_assert(internal::GetSourceRootLength("C:/src", "C:/src/project/") == 0);
+static_assert(internal::GetSourceRootLength("C:/src/project/file.cpp", "") == 0);
+
+//
+// source_location
+//
+
+TEST(source_location_Test, current_InSourceRoot_IsRelative) {
+	const std::source_location expected = std::source_location::current();
+	const source_location location = source_location::current();
+
+	EXPECT_EQ(expected.line() + 1, location.line());
+	EXPECT_STREQ(expected.function_name(), location.function_name());
+	std::string fileName(location.file_name());
+	std::replace(fileName.begin(), fileName.end(), '\\', '/');
+	EXPECT_EQ("test/source_location.test.cpp", fileName);
+	EXPECT_EQ(expected.file_name() + std::strlen(expected.file_name()) - std::strlen(location.file_name()), location.file_name());
+}
+
+TEST(source_location_Test, current_AsDefaultArgument_IsCaller) {
+	const auto get = [](const source_location location = source_location::current()) noexcept {
+		return location;
+	};
+
+	const std::uint_least32_t line = std::source_location::current().line() + 1;
+	const source_location location = get();
+
+	EXPECT_EQ(line, location.line());
+}
+
+}  // namespace
+}  // namespace m3c::test
@@ -0,0 +1,147 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/throw.h"
+
+#include "m3c/exception.h"
+#include <m3c/source_location.h>
+
+#include "test.events.h"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <windows.h>
+#include <evntprov.h>
+#include <rpc.h>
+
+#include <cstdint>
+#include <source_location>
+#include <system_error>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+//
+// throw_windows_error
+//
+
+TEST(throw_windows_error_Test, call_Default_ThrowWithSourceLocation) {
+	constexpr std::uint_least32_t kLine = std::source_location::current().line() + 2;
+	EXPECT_THAT(([]() {
+		            throw_windows_error(ERROR_ACCESS_DENIED);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<windows_error, const char*>>(
+	                t::AllOf(
+	                    t::Property(&windows_error::code, t::Property(&std::error_code::value, ERROR_ACCESS_DENIED)),
+	                    t::Property(&internal::BaseException<const char*>::GetLogMessage, nullptr),
+	                    t::Property(&internal::BaseException<const char*>::GetSourceLocation, t::Property(&std::source_location::line, kLine))))));
+}
+
+TEST(throw_windows_error_Test, call_Event_ThrowWithEvent) {
+	constexpr std::uint_least32_t kLine = std::source_location::current().line() + 2;
+	EXPECT_THAT(([]() {
+		            throw_windows_error(ERROR_ACCESS_DENIED, evt::Test_Event);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<windows_error, const EVENT_DESCRIPTOR&>>(
+	                t::AllOf(
+	                    t::Property(&windows_error::code, t::Property(&std::error_code::value, ERROR_ACCESS_DENIED)),
+	                    t::Property(&internal::BaseException<const EVENT_DESCRIPTOR&>::GetEvent, t::Field(&EVENT_DESCRIPTOR::Id, evt::Test_Event.Id)),
+	                    t::Property(&internal::BaseException<const EVENT_DESCRIPTOR&>::GetSourceLocation, t::Property(&std::source_location::line, kLine))))));
+}
+
+TEST(throw_windows_error_Test, call_Message_ThrowWithMessage) {
+	constexpr std::uint_least32_t kLine = std::source_location::current().line() + 2;
+	EXPECT_THAT(([]() {
+		            throw_windows_error(ERROR_ACCESS_DENIED, "TestEvent");
+	            }),
+	            (t::Throws<internal::ExceptionDetail<windows_error, const char*>>(
+	                t::AllOf(
+	                    t::Property(&windows_error::code, t::Property(&std::error_code::value, ERROR_ACCESS_DENIED)),
+	                    t::Property(&internal::BaseException<const char*>::GetLogMessage, t::StrEq("TestEvent")),
+	                    t::Property(&internal::BaseException<const char*>::GetSourceLocation, t::Property(&std::source_location::line, kLine))))));
+}
+
+
+//
+// throw_rpc_error
+//
+
+TEST(throw_rpc_error_Test, call_Default_ThrowWithSourceLocation) {
+	constexpr std::uint_least32_t kLine = std::source_location::current().line() + 2;
+	EXPECT_THAT(([]() {
+		            throw_rpc_error(RPC_S_OUT_OF_MEMORY);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<rpc_error, const char*>>(
+	                t::AllOf(
+	                    t::Property(&rpc_error::code, t::Property(&std::error_code::value, RPC_S_OUT_OF_MEMORY)),
+	                    t::Property(&internal::BaseException<const char*>::GetLogMessage, nullptr),
+	                    t::Property(&internal::BaseException<const char*>::GetSourceLocation, t::Property(&std::source_location::line, kLine))))));
+}
+
+TEST(throw_rpc_error_Test, call_Event_ThrowWithEvent) {
+	EXPECT_THAT(([]() {
+		            throw_rpc_error(RPC_S_OUT_OF_MEMORY, evt::Test_Event);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<rpc_error, const EVENT_DESCRIPTOR&>>(
+	                t::Property(&internal::BaseException<const EVENT_DESCRIPTOR&>::GetEvent, t::Field(&EVENT_DESCRIPTOR::Id, evt::Test_Event.Id)))));
+}
+
+TEST(throw_rpc_error_Test, call_Message_ThrowWithMessage) {
+	EXPECT_THAT(([]() {
+		            throw_rpc_error(RPC_S_OUT_OF_MEMORY, "TestEvent");
+	            }),
+	            (t::Throws<internal::ExceptionDetail<rpc_error, const char*>>(
+	                t::Property(&internal::BaseException<const char*>::GetLogMessage, t::StrEq("TestEvent")))));
+}
+
+
+//
+// throw_com_error
+//
+
+TEST(throw_com_error_Test, call_Default_ThrowWithSourceLocation) {
+	constexpr std::uint_least32_t kLine = std::source_location::current().line() + 2;
+	EXPECT_THAT(([]() {
+		            throw_com_error(E_NOTIMPL);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<com_error, const char*>>(
+	                t::AllOf(
+	                    t::Property(&com_error::code, t::Property(&std::error_code::value, E_NOTIMPL)),
+	                    t::Property(&internal::BaseException<const char*>::GetLogMessage, nullptr),
+	                    t::Property(&internal::BaseException<const char*>::GetSourceLocation, t::Property(&std::source_location::line, kLine))))));
+}
+
+TEST(throw_com_error_Test, call_Event_ThrowWithEvent) {
+	EXPECT_THAT(([]() {
+		            throw_com_error(E_NOTIMPL, evt::Test_Event);
+	            }),
+	            (t::Throws<internal::ExceptionDetail<com_error, const EVENT_DESCRIPTOR&>>(
+	                t::Property(&internal::BaseException<const EVENT_DESCRIPTOR&>::GetEvent, t::Field(&EVENT_DESCRIPTOR::Id, evt::Test_Event.Id)))));
+}
+
+TEST(throw_com_error_Test, call_Message_ThrowWithMessage) {
+	EXPECT_THAT(([]() {
+		            throw_com_error(E_NOTIMPL, "TestEvent");
+	            }),
+	            (t::Throws<internal::ExceptionDetail<com_error, const char*>>(
+	                t::Property(&internal::BaseException<const char*>::GetLogMessage, t::StrEq("TestEvent")))));
+}
+
+}  // namespace
+}  // namespace m3c::test
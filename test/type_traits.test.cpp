@@ -22,6 +22,8 @@ limitations under the License.
 #include <span>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <type_traits>
 
 namespace m3c::test {
 namespace {
@@ -52,6 +54,32 @@ static_assert(AnyOf<char, int, char, short>);
 static_assert(!AnyOf<char, int, char*, short>);
 
 
+//
+// type_list / index_of / contains / type_at
+//
+
+static_assert(type_list<>::size == 0);
+static_assert(type_list<int, char, short>::size == 3);
+
+static_assert(index_of<int, type_list<int, char, short>>::value == 0);
+static_assert(index_of_v<short, type_list<int, char, short>> == 2);
+static_assert(index_of_v<char, type_list<int, char, char>> == 1);
+static_assert(index_of_v<long, type_list<int, char, short>> == 3);
+static_assert(index_of_v<long, type_list<>> == 0);
+static_assert(index_of_v<char, std::tuple<int, char, short>> == 1);
+
+static_assert(contains<char, type_list<int, char, short>>::value);
+static_assert(contains_v<char, type_list<int, char, short>>);
+static_assert(!contains_v<char*, type_list<int, char, short>>);
+static_assert(!contains_v<char, type_list<>>);
+static_assert(contains_v<char, std::tuple<int, char, short>>);
+
+static_assert(std::is_same_v<type_at<0, type_list<int, char, short>>::type, int>);
+static_assert(std::is_same_v<type_at_t<2, type_list<int, char, short>>, short>);
+static_assert(std::is_same_v<type_at_t<1, type_list<int, int, int>>, int>);
+static_assert(std::is_same_v<type_at_t<1, std::tuple<int, char, short>>, char>);
+
+
 //
 // is_pointer_to / PointerTo
 //
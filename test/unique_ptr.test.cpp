@@ -32,6 +32,7 @@ limitations under the License.
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <memory_resource>
 #include <new>  // IWYU pragma: keep
 #include <string>
 #include <utility>
@@ -81,6 +82,40 @@ private:
 #define MOCK_EXPECT_NOT_DELETED(name_) \
 	EXPECT_FALSE(name_##_deleted) << #name_ " was deleted"
 
+/// @brief A stateless deleter which counts the number of calls.
+struct CountingDelete final {
+	void operator()(Foo* const p) const noexcept {
+		++s_calls;
+		delete p;
+	}
+	static inline int s_calls = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables): Call counter for tests.
+};
+
+/// @brief A memory resource which counts allocations.
+class CountingResource final : public std::pmr::memory_resource {
+public:
+	std::size_t allocations = 0;    // NOLINT(misc-non-private-member-variables-in-classes): Test helper.
+	std::size_t deallocations = 0;  // NOLINT(misc-non-private-member-variables-in-classes): Test helper.
+
+private:
+	void* do_allocate(const std::size_t bytes, const std::size_t alignment) final {
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+	void do_deallocate(void* const p, const std::size_t bytes, const std::size_t alignment) final {
+		++deallocations;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& oth) const noexcept final {
+		return this == &oth;
+	}
+};
+
+static_assert(sizeof(unique_ptr<Foo>) == sizeof(Foo*));
+static_assert(sizeof(unique_ptr<Foo, CountingDelete>) == sizeof(Foo*));
+static_assert(sizeof(unique_ptr<int[]>) == sizeof(int*));
+static_assert(sizeof(unique_ptr<int, allocator_delete<int, std::pmr::polymorphic_allocator<int>>>) == sizeof(int*));
+
 //
 // unique_ptr()
 //
@@ -724,6 +759,122 @@ TEST(unique_ptr_Test, makeUnique_WithArg_ObjectCreated) {
 }
 
 
+//
+// allocate_unique
+//
+
+TEST(unique_ptr_Test, allocateUnique_WithArg_ObjectCreated) {
+	CountingResource resource;
+	{
+		unique_ptr<int, allocator_delete<int, std::pmr::polymorphic_allocator<int>>> ptr = allocate_unique<int>(std::pmr::polymorphic_allocator<int>(&resource), 7);
+
+		EXPECT_NOT_NULL(ptr);
+		EXPECT_EQ(7, *ptr);
+		EXPECT_EQ(1U, resource.allocations);
+		EXPECT_EQ(0U, resource.deallocations);
+	}
+	EXPECT_EQ(1U, resource.allocations);
+	EXPECT_EQ(1U, resource.deallocations);
+}
+
+TEST(unique_ptr_Test, allocateUnique_Value_DeleteObject) {
+	std::pmr::monotonic_buffer_resource resource;
+	std::pmr::polymorphic_allocator<Foo> alloc(&resource);
+	bool deleted = false;
+
+	{
+		auto ptr = allocate_unique<t::StrictMock<Foo>>(alloc);
+		EXPECT_CALL(*ptr, Die).WillOnce(t::Assign(&deleted, true));
+	}
+	EXPECT_TRUE(deleted);
+}
+
+TEST(unique_ptr_Test, allocateUnique_UsesAllocator_PropagateResource) {
+	CountingResource resource;
+	{
+		auto ptr = allocate_unique<std::pmr::string>(std::pmr::polymorphic_allocator<std::byte>(&resource), 100, 'x');
+
+		EXPECT_EQ(&resource, ptr->get_allocator().resource());
+		EXPECT_EQ(2U, resource.allocations);
+	}
+	EXPECT_EQ(2U, resource.deallocations);
+}
+
+TEST(unique_ptr_Test, allocateUnique_ConstructorThrows_ReleaseMemory) {
+	struct Throwing {
+		Throwing() {
+			throw std::exception();
+		}
+	};
+	CountingResource resource;
+
+	EXPECT_THROW((void) allocate_unique<Throwing>(std::pmr::polymorphic_allocator<Throwing>(&resource)), std::exception);
+
+	EXPECT_EQ(1U, resource.allocations);
+	EXPECT_EQ(1U, resource.deallocations);
+}
+
+TEST(unique_ptr_Test, allocateUnique_Reset_ReleaseMemory) {
+	CountingResource resource;
+	auto ptr = allocate_unique<int>(std::pmr::polymorphic_allocator<int>(&resource), 7);
+
+	ptr.reset();
+
+	EXPECT_NULL(ptr);
+	EXPECT_EQ(1U, resource.deallocations);
+}
+
+
+//
+// Deleter
+//
+
+TEST(unique_ptr_Test, dtor_CustomDeleter_CallDeleter) {
+	MOCK_SETUP(pFoo);
+	CountingDelete::s_calls = 0;
+
+	{
+		unique_ptr<Foo, CountingDelete> ptr(pFoo);
+	}
+	EXPECT_EQ(1, CountingDelete::s_calls);
+	MOCK_EXPECT_DELETED(pFoo);
+}
+
+TEST(unique_ptr_Test, dtor_CustomDeleterEmpty_NoCall) {
+	CountingDelete::s_calls = 0;
+
+	{
+		unique_ptr<Foo, CountingDelete> ptr;
+	}
+	EXPECT_EQ(0, CountingDelete::s_calls);
+}
+
+TEST(unique_ptr_Test, opAddressOf_CustomDeleter_CallDeleter) {
+	MOCK_SETUP(pFoo);
+	CountingDelete::s_calls = 0;
+
+	unique_ptr<Foo, CountingDelete> ptr(pFoo);
+	const Foo* const* const pp = &ptr;
+
+	EXPECT_NULL(ptr);
+	EXPECT_NULL(*pp);
+	EXPECT_EQ(1, CountingDelete::s_calls);
+	MOCK_EXPECT_DELETED(pFoo);
+}
+
+TEST(unique_ptr_Test, opEquals_CustomDeleter_Compare) {
+	MOCK_SETUP(pFoo);
+	CountingDelete::s_calls = 0;
+
+	unique_ptr<Foo, CountingDelete> ptr(pFoo);
+	unique_ptr<Foo> oth;
+
+	EXPECT_TRUE(ptr != oth);
+	EXPECT_TRUE(ptr == pFoo);
+	EXPECT_EQ(std::hash<Foo*>{}(pFoo), std::hash<unique_ptr<Foo, CountingDelete>>{}(ptr));
+}
+
+
 //
 // std::swap
 //
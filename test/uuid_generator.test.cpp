@@ -0,0 +1,176 @@
+/*
+Copyright 2026 Michael Beckh
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "m3c/uuid_generator.h"
+
+#include <gtest/gtest.h>
+
+#include <windows.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+namespace m3c::test {
+namespace {
+
+namespace t = testing;
+
+/// @brief Get the fields of a `GUID` in the order of the string representation.
+/// @param guid A `GUID`.
+/// @return A tuple for comparing `GUID` values.
+auto Fields(const GUID& guid) noexcept {
+	std::uint64_t low = 0;
+	for (const unsigned char value : guid.Data4) {
+		low = (low << 8) | value;
+	}
+	return std::make_tuple(guid.Data1, guid.Data2, guid.Data3, low);
+}
+
+/// @brief Get the milliseconds since the UNIX epoch stored in a version 7 UUID.
+/// @param guid A version 7 UUID.
+/// @return The timestamp.
+std::uint64_t Timestamp(const GUID& guid) noexcept {
+	return (static_cast<std::uint64_t>(guid.Data1) << 16) | guid.Data2;
+}
+
+/// @brief Check if two `GUID` values are ordered using `memcmp`.
+/// @param lhs A `GUID`.
+/// @param rhs Another `GUID`.
+/// @return `true` if @p lhs is less than @p rhs.
+bool Less(const GUID& lhs, const GUID& rhs) noexcept {
+	return std::memcmp(&lhs, &rhs, sizeof(GUID)) < 0;
+}
+
+/// @brief Check if a list of `GUID` values contains duplicates.
+/// @param guids The list of values.
+/// @return `true` if @p guids contains duplicates.
+bool HasDuplicates(std::vector<GUID>& guids) {
+	std::sort(guids.begin(), guids.end(), Less);
+	return std::adjacent_find(guids.begin(), guids.end(), [](const GUID& lhs, const GUID& rhs) noexcept {
+		       return IsEqualGUID(lhs, rhs);
+	       }) != guids.end();
+}
+
+constexpr std::size_t kCount = 10'000;
+
+//
+// v4
+//
+
+TEST(uuid_generator_Test, v4_Call_HasVersionAndVariant) {
+	const GUID guid = uuid_generator::v4();
+
+	EXPECT_EQ(0x4000, guid.Data3 & 0xF000);
+	EXPECT_EQ(0x80, guid.Data4[0] & 0xC0);
+}
+
+TEST(uuid_generator_Test, v4_CallRepeatedly_AreUnique) {
+	std::vector<GUID> guids;
+	guids.reserve(kCount);
+	for (std::size_t i = 0; i < kCount; ++i) {
+		guids.push_back(uuid_generator::v4());
+	}
+
+	EXPECT_FALSE(HasDuplicates(guids));
+}
+
+TEST(uuid_generator_Test, v4_MultipleThreads_AreUnique) {
+	std::array<std::vector<GUID>, 4> guids;
+	{
+		std::array<std::jthread, 4> threads;
+		for (std::size_t i = 0; i < threads.size(); ++i) {
+			threads[i] = std::jthread([&result = guids[i]] {
+				result.reserve(kCount);
+				for (std::size_t j = 0; j < kCount; ++j) {
+					result.push_back(uuid_generator::v4());
+				}
+			});
+		}
+	}
+
+	std::vector<GUID> all;
+	for (const std::vector<GUID>& result : guids) {
+		all.insert(all.end(), result.cbegin(), result.cend());
+	}
+	EXPECT_EQ(guids.size() * kCount, all.size());
+	EXPECT_FALSE(HasDuplicates(all));
+}
+
+
+//
+// v7
+//
+
+TEST(uuid_generator_Test, v7_Call_HasVersionAndVariant) {
+	const GUID guid = uuid_generator::v7();
+
+	EXPECT_EQ(0x7000, guid.Data3 & 0xF000);
+	EXPECT_EQ(0x80, guid.Data4[0] & 0xC0);
+}
+
+TEST(uuid_generator_Test, v7_Call_HasCurrentTime) {
+	const std::uint64_t before = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	const GUID guid = uuid_generator::v7();
+	const std::uint64_t after = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+	// allow some leeway because the timestamp may run ahead if many values have been created
+	EXPECT_LE(before, Timestamp(guid));
+	EXPECT_GE(after + 1000, Timestamp(guid));
+}
+
+TEST(uuid_generator_Test, v7_CallRepeatedly_AreIncreasing) {
+	GUID last = uuid_generator::v7();
+	for (std::size_t i = 0; i < kCount; ++i) {
+		const GUID guid = uuid_generator::v7();
+
+		ASSERT_LT(Fields(last), Fields(guid));
+		last = guid;
+	}
+}
+
+TEST(uuid_generator_Test, v7_MultipleThreads_AreIncreasingAndUnique) {
+	std::array<std::vector<GUID>, 4> guids;
+	{
+		std::array<std::jthread, 4> threads;
+		for (std::size_t i = 0; i < threads.size(); ++i) {
+			threads[i] = std::jthread([&result = guids[i]] {
+				result.reserve(kCount);
+				for (std::size_t j = 0; j < kCount; ++j) {
+					result.push_back(uuid_generator::v7());
+				}
+			});
+		}
+	}
+
+	std::vector<GUID> all;
+	for (const std::vector<GUID>& result : guids) {
+		EXPECT_TRUE(std::is_sorted(result.cbegin(), result.cend(), [](const GUID& lhs, const GUID& rhs) noexcept {
+			return Fields(lhs) < Fields(rhs);
+		}));
+		all.insert(all.end(), result.cbegin(), result.cend());
+	}
+	EXPECT_FALSE(HasDuplicates(all));
+}
+
+}  // namespace
+}  // namespace m3c::test